@@ -331,6 +331,16 @@ void render_public(Document &doc, Type<T> t) {
     else if (!std::is_empty_v<T>) std::cout << "not rendering members of type " << typeid(T).name() << std::endl;
 }
 
+/// Like render_public(), but each member is returned by const reference so it cannot be modified
+template <class T>
+void render_readonly(Document &doc, Type<T> t) {
+    for_each_zip(T::names(), T::accesses(), [&](char const *n, auto f) {
+        if constexpr(std::is_member_object_pointer_v<decltype(f)>) {
+            doc.method(t, n-1, [f](T const &x) -> decltype(auto) {return x.*f;});
+        }
+    });
+}
+
 /******************************************************************************/
 
 template <class T>
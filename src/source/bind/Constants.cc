@@ -13,7 +13,9 @@ namespace nupack {
 void render(Document &doc, Type<Local> t) {
     doc.type(t, "core.Local");
     doc.method<0>(t, "new", rebind::construct<usize>(t));
+    doc.method<0>(t, "new", rebind::construct<usize, bool>(t));
     doc.method(t, "n_workers", &Local::n_workers);
+    doc.method(t, "numa", &Local::numa);
 }
 
 /******************************************************************************************/
@@ -1,4 +1,5 @@
 #include "Math.h"
+#include <nupack/execution/Local.h>
 
 namespace nupack {
 
@@ -41,7 +42,12 @@ void render(Document &doc, Type<Options> t) {
 /**************************************************************************************/
 
 void render_math(Document &doc) {
-    doc.function("concentration.solve", &concentration::equilibrate);
+    doc.function("concentration.solve", [](real_mat const &A, real_col logb, real_col const &logq, concentration::Options const &ops) {
+        return concentration::equilibrate(A, std::move(logb), logq, ops);
+    });
+    doc.function("concentration.solve_batch", [](Local const &env, real_mat const &A, real_mat const &logb, real_col const &logq, concentration::Options const &ops) {
+        return concentration::equilibrate_batch(env, A, logb, logq, ops);
+    });
     doc.function("concentration.solve_complexes", &concentration::solve_complexes);
 }
 
@@ -1,5 +1,7 @@
 #include "Model.h"
 #include <nupack/state/State.h>
+#include <nupack/state/Kinetics.h>
+#include <nupack/execution/Local.h>
 
 namespace nupack {
 
@@ -8,6 +10,9 @@ namespace nupack {
 void render(Document &doc, Type<ParameterFile> t) {
     doc.type(t, "model.ParameterFile");
     doc.method(t, "new", rebind::construct<string>(t));
+    doc.method(t, "resolve", &ParameterFile::resolve);
+    doc.method(t, "compile", &ParameterFile::compile);
+    doc.function("model.clear_parameter_registry", &ParameterFile::clear_registry);
     NUPACK_PUBLIC(ParameterFile, path);
 }
 
@@ -59,6 +64,20 @@ void render_model(Document &doc) {
     doc.function("model.loop_structure", find_loop_structure_nick);
     doc.function("model.structure_energy", &structure_energy<StrandList, Model<real64>>);
     doc.function("model.structure_energy", &structure_energy<StrandList, Model<real32>>);
+    doc.function("model.structure_energies", [](Local const &env, vec<std::pair<StrandList, PairList>> const &v, Model<real64> const &m, bool d) {
+        return structure_energies(env, v, m, d);
+    });
+    doc.function("model.structure_energies", [](Local const &env, vec<std::pair<StrandList, PairList>> const &v, Model<real32> const &m, bool d) {
+        return structure_energies(env, v, m, d);
+    });
+    doc.function("model.first_passage_times", [](Local const &env, StrandList const &strands, PairList start, Model<real64> const &m,
+                 vec<std::pair<PairList, usize>> const &targets, usize n, real max_time, usize max_steps, real uni, real bi, real molarity, usize seed) {
+        if (seed) StaticRNG.seed(seed);
+        auto conditions = vmap(targets, [](auto const &t) {return StopCondition{t.first, t.second};});
+        StateBase const w(std::make_shared<System const>(strands), std::move(start));
+        auto v = first_passage_times(env, w, m, std::move(conditions), n, max_time, KineticRates{uni, bi, molarity}, max_steps);
+        return vmap(std::move(v), [](auto &&f) {return std::make_tuple(f.time, f.steps, f.condition, std::move(f.pairs), f.energy);});
+    });
 }
 
 /******************************************************************************************/
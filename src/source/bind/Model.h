@@ -40,7 +40,8 @@ template <class T>
 void render(Document &doc, Type<Model<T>> t, int=0) {
     using M = Model<T>;
     doc.type(t, "model.Model", CHAR_BIT * sizeof(T));
-    render_public(doc, t);
+    // read-only so that the fingerprint computed on construction stays valid
+    render_readonly(doc, t);
     render_comparisons(doc, t);
 
     doc.method(t, "new", [](Ensemble e, ParameterFile const &p, ModelConditions const &cs, uint gu) {
@@ -49,6 +50,22 @@ void render(Document &doc, Type<Model<T>> t, int=0) {
         set_sequence_type_weak(mod.parameters.material == "RNA");
         return mod;
     });
+    doc.method(t, "fingerprint",          [](M const &m) {return m.fingerprint().hex();});
+    doc.method(t, "parameter",            [](M const &m, usize i) {
+        NUPACK_REQUIRE(i, <, ParameterData<T>::size, "parameter index out of range");
+        return m.parameters.data.begin()[i];
+    });
+    // copy with one entry of the parameter array replaced; the array is shared between copies so it is reallocated
+    doc.method(t, "with_parameter",       [](M const &m, usize i, T value) {
+        NUPACK_REQUIRE(i, <, ParameterData<T>::size, "parameter index out of range");
+        M out = m;
+        out.parameters.data = ParameterData<T>(ParameterData<T>::allocate());
+        std::copy(m.parameters.data.begin(), m.parameters.data.end(), out.parameters.data.begin());
+        out.parameters.data.begin()[i] = value;
+        out.update_fingerprint();
+        return out;
+    });
+    doc.method(t, "with_ensemble",        &M::with_ensemble);
     doc.method(t, "join_penalty",         &M::join_penalty);
     doc.method(t, "multi_init",           &M::multi_init);
     doc.method(t, "multi_base",           &M::multi_base);
@@ -75,7 +92,12 @@ template <class T>
 void render(Document &doc, Type<ParameterData<T>> t, int=0) {
     doc.type(t, "model.ParameterData");
     doc.method(t, "new", rebind::construct(t));
-    doc.method(t, "new", [](ParameterFile const &file, string const &kind) {return ParameterData<T>(file.open().at(kind));});
+    doc.method(t, "new", [](ParameterFile const &file, string const &kind) {
+        auto const &d = file.load()->at(kind);
+        ParameterData<T> out(ParameterData<T>::allocate());
+        std::copy(d.begin(), d.end(), out.begin());
+        return out;
+    });
     // doc.method(t, "array", [](ParameterData<T> const &p) {
     //     NUPACK_ASSERT(p.array, "empty parameters");
     //     return arma::Col<T>(p.array.get(), ParameterData<T>::size);
@@ -27,6 +27,32 @@ void render(Document &doc, Type<MemoryLimit> t) {
 
 /******************************************************************************************/
 
+void render(Document &doc, Type<JobLimits> t) {
+    doc.type(t, "thermo.JobLimits");
+    render_public(doc, t);
+}
+
+void render(Document &doc, Type<JobExecutor> t) {
+    doc.type(t, "thermo.JobExecutor");
+    doc.method(t, "new", rebind::construct<Local>(t));
+    doc.method(t, "n_workers", &JobExecutor::n_workers);
+}
+
+void render(Document &doc, Type<Job<real>> t) {
+    doc.type(t, "thermo.Job");
+    doc.method(t, "progress", &Job<real>::progress);
+    doc.method(t, "ready", &Job<real>::ready);
+    doc.method(t, "wait", &Job<real>::wait);
+    doc.method(t, "cancel", &Job<real>::cancel);
+    doc.method(t, "pause", &Job<real>::pause);
+    doc.method(t, "resume", &Job<real>::resume);
+    doc.method(t, "memory", &Job<real>::memory);
+    doc.method(t, "stopped", [](Job<real> const &j) {return static_cast<int>(j.stopped());});
+    doc.method(t, "get", [](Job<real> const &j) {return j.get();});
+}
+
+/******************************************************************************************/
+
 void render_pf(Document &doc);
 
 void render_mfe(Document &doc) {
@@ -3,12 +3,16 @@
 #include <nupack/thermo/Engine.h>
 #include <nupack/thermo/CachedModel.h>
 #include <nupack/thermo/ComplexSampler.h>
+#include <nupack/thermo/Job.h>
 #include <nupack/types/Structure.h>
 #include <nupack/execution/Local.h>
 
 namespace nupack::thermo {
 
 void render(Document &, Type<MemoryLimit>);
+void render(Document &, Type<JobLimits>);
+void render(Document &, Type<JobExecutor>);
+void render(Document &, Type<Job<real>>);
 
 /******************************************************************************************/
 
@@ -47,8 +51,16 @@ void render(Document &doc, Type<L> t) {
 
 inline void render(Document &doc, Type<PairingAction> t) {
     doc.type(t, "thermo.PairingAction");
-    // doc.method(t, "new", rebind::construct<rebind::Callback<bool>>(t));
     doc.method(t, "new", rebind::construct(t));
+    // the permitted pairs are given up front so that the recursions never call back into Python
+    doc.method(t, "new", [](std::uint32_t n, vec<std::pair<std::uint32_t, std::uint32_t>> const &pairs) {
+        PairingAction out{PairMask(n)};
+        for (auto const &p : pairs) {
+            if (p.first >= n || p.second >= n) NUPACK_ERROR("pair index out of range", p.first, p.second, n);
+            out.mask.set(p.first, p.second);
+        }
+        return out;
+    });
 }
 
 /******************************************************************************************/
@@ -64,18 +76,27 @@ void render(Document &doc, Type<XTensor<T>> t) {
 template <class T, NUPACK_IF(traits::is_record<T>)>
 void render(Document &doc, Type<T> t) {doc.type(t, "thermo.Record");}
 
+template <class T, NUPACK_IF(traits::is_compressed_record<T>)>
+void render(Document &doc, Type<T> t) {doc.type(t, "thermo.CompressedRecord");}
+
 template <class T, NUPACK_IF(traits::is_block<T>)>
 void render(Document &doc, Type<T> t) {doc.type(t, "thermo.Block");}
 
 /******************************************************************************************/
 
-template <int N, class Ensemble, class ...Ts>
-void render(Document &doc, Type<Cache<N, Ensemble, Ts...>> t) {
-    using C = Cache<N, Ensemble, Ts...>;
+/// Render a Cache or CostAwareCache, which differ only in eviction policy
+template <int N, class Ensemble, class ...Ts, class C>
+void render_cache(Document &doc, Type<C> t, char const *name) {
     doc.render<typename C::base_type>();
-    doc.type(t, "thermo.Cache", std::make_tuple(N,  EnsembleType(Ensemble()).index(), overflow_bits<Ts>...));
+    doc.type(t, name, std::make_tuple(N,  EnsembleType(Ensemble()).index(), overflow_bits<Ts>...));
     // <base_type_of<L>>
-    doc.method(t, "new", rebind::construct<std::size_t>(t));
+    doc.method(t, "new", rebind::construct<std::size_t, bool>(t));
+    doc.method(t, "new", [](std::size_t n, bool compress, std::string directory, std::string fingerprint) {
+        return C(n, std::make_shared<BlockStore const>(std::move(directory), std::move(fingerprint)), compress);
+    });
+    doc.method(t, "directory", [](C const &c) {return c.disk ? c.disk->location() : std::string();});
+    doc.method(t, "compressed", [](C const &c) {return c.compress;});
+    doc.method(t, "contains", [](C const &l, Complex const &k) {return l.find(k) != end_of(l);});
     doc.method(t, "[]", [](C const &l, Complex const &k) {
         auto it = l.find(k);
         if (it == end_of(l)) throw std::out_of_range("Key not found in LRU");
@@ -83,6 +104,31 @@ void render(Document &doc, Type<Cache<N, Ensemble, Ts...>> t) {
     });
 }
 
+template <int N, class Ensemble, class ...Ts>
+void render(Document &doc, Type<Cache<N, Ensemble, Ts...>> t) {render_cache<N, Ensemble, Ts...>(doc, t, "thermo.Cache");}
+
+template <int N, class Ensemble, class ...Ts>
+void render(Document &doc, Type<CostAwareCache<N, Ensemble, Ts...>> t) {render_cache<N, Ensemble, Ts...>(doc, t, "thermo.CostAwareCache");}
+
+/******************************************************************************************/
+
+template <int N, class Ensemble, class ...Ts>
+void render(Document &doc, Type<ShardedCache<N, Ensemble, Ts...>> t) {
+    using C = ShardedCache<N, Ensemble, Ts...>;
+    doc.type(t, "thermo.ShardedCache", std::make_tuple(N,  EnsembleType(Ensemble()).index(), overflow_bits<Ts>...));
+    doc.method(t, "new", rebind::construct<std::size_t, bool>(t));
+    doc.method(t, "new", [](std::size_t n, bool compress, std::string directory, std::string fingerprint) {
+        return C(n, std::make_shared<BlockStore const>(std::move(directory), std::move(fingerprint)), compress);
+    });
+    doc.method(t, "directory", [](C const &c) {return c.disk ? c.disk->location() : std::string();});
+    doc.method(t, "compressed", [](C const &c) {return c.compress;});
+    doc.method(t, "length", [](C const &c) {return c.length();});
+    doc.method(t, "capacity", [](C const &c) {return c.capacity();});
+    doc.method(t, "size", [](C const &c) {return c.size();});
+    doc.method(t, "clear", [](C &c) {c.clear();});
+    doc.method(t, "contains", [](C const &c, Complex const &k) {return c.visit(k, [](auto const &) {});});
+}
+
 /******************************************************************************************/
 
 template <class M, NUPACK_IF(traits::is_parameter_cache<M>)>
@@ -149,6 +195,13 @@ void render_engine(rebind::Document &doc, pack<Types...> ts, pack<Dangles...> ds
     using Obs = rebind::Callback<void>;
     using boolCall = rebind::Callback<bool>;
 
+    // the job owns copies of the models and its own cache so that it does not refer to Python objects
+    doc.function("thermo.submit_dynamic_program", [](JobExecutor const &exe, Complex const &cx, Models m, real cache, JobLimits const &limits, bool paused) {
+        return exe.submit([cx, models=std::tuple<CachedModel<Rig, Model<Types>>...>(m), cache](Local const &env) mutable {
+            return dynamic_program<N, Bs...>(env, cx, models, cache);
+        }, limits, paused);
+    });
+
     Caches::for_each([&doc](auto cache) {
         using C = decltype(*cache);
         doc.function("thermo.dynamic_program", [](rebind::Caller call, Local env, Complex const &cx, Models m, C c, Obs o, PairingAction const &a) {
@@ -194,6 +247,16 @@ void render_engine(rebind::Document &doc, pack<Types...> ts, pack<Dangles...> ds
             return out;
         });
     });
+
+    // the other cache types are only accepted by the plain dynamic program, to bound compile time
+    using OtherCaches = rebind::Pack<ShardedCache<N, Dangles, oflow<Bs, Types>...> &...,
+                                     CostAwareCache<N, Dangles, oflow<Bs, Types>...> &...>;
+    OtherCaches::for_each([&doc](auto cache) {
+        using C = decltype(*cache);
+        doc.function("thermo.dynamic_program", [](rebind::Caller call, Local env, Complex const &cx, Models m, C c, Obs o, PairingAction const &a) {
+            return dynamic_program<N, Bs...>(env, cx, m, c, std::move(o), a);
+        });
+    });
 }
 
 /******************************************************************************************/
@@ -203,6 +266,8 @@ void render_lru(Document &doc) {
     for (auto e : AllEnsembles) fork(ensemble_variant(e), [&](auto d) {
         static_assert(traits::is_cache<Cache<N, decltype(d), Ts...>>, "");
         doc.render<Cache<N, decltype(d), Ts...>>();
+        doc.render<ShardedCache<N, decltype(d), Ts...>>();
+        doc.render<CostAwareCache<N, decltype(d), Ts...>>();
     });
 }
 
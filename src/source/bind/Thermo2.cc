@@ -2,6 +2,7 @@
 #include <nupack/thermo/CachedModel.h>
 #include <nupack/thermo/Adapters.h>
 #include <nupack/thermo/ComplexSampler.h>
+#include <nupack/thermo/Gradient.h>
 #include <nupack/Forward.h>
 #include <nupack/model/Model.h>
 
@@ -31,6 +32,24 @@ void render_pf(Document &doc) {
     render_lru<3, overflow<real64>>(doc);
     render_engine<PF, 3, 1>(doc, pack<real64>(), as_pack<EnsembleType>());
     doc.render<ComplexSampler>();
+
+    doc.function("thermo.ensemble_energies", [](Local env, Complex const &cx, Model<real64> const &m) {
+        auto const e = ensemble_energies(env, cx, std::make_tuple(dual_model(m)));
+        return std::make_tuple(e.free_energy, e.enthalpy, e.entropy);
+    });
+
+    doc.function("thermo.log_pfunc_gradient", [](Local env, Complex const &cx, Model<real64> const &m) {
+        auto g = log_pfunc_gradient(env, cx, gradient_pf_model(m));
+        return std::make_pair(g.log_pfunc, std::move(g.gradient));
+    });
+
+    // the database is given as JSON: {"data": {"<strands joined by +>": {"result", "material", "T", "sodium", "magnesium"}}}
+    doc.function("thermo.pfunc_gradients", [](Local env, json const &j, Ensemble e) {
+        std::map<string, std::pair<real, vec<real>>> out;
+        for (auto &[k, g] : pfunc_gradients(env, j.get<JsonDatabase<std::map<string, PfuncDatum>>>(), e))
+            out.emplace(k, std::make_pair(g.log_pfunc, std::move(g.gradient)));
+        return out;
+    });
 }
 
 /******************************************************************************************/
@@ -145,7 +145,7 @@ install(TARGETS nupack-bind DESTINATION ${CMAKE_INSTALL_LIBDIR})
 set(design_lib_source SequenceAdapter.cc ThermoWrapper.cc Complex.cc Defect.cc
     Tube.cc Design.cc Designer.cc Decomposition.cc Split.cc
     Specification.cc Result.cc OutputResult.cc Granularity.cc DesignComponents.cc Models.cc
-    Objectives.cc Weights.cc Constraints.cc)
+    Objectives.cc Weights.cc Constraints.cc CostModel.cc)
 prefix_transform(design_lib_source "source/design" ${design_lib_source})
 
 set(old_design_files constraint_handler.cc sequence_utils.cc)
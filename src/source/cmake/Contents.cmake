@@ -14,6 +14,9 @@ set(LIBNUPACK_FILES
     source/Constants.cc
     source/Runtime.cc
     source/Costs.cc
+    source/BlockStore.cc
+    source/Compression.cc
+    source/Numa.cc
 )
 
 set(NUPACK_MODULE_FILES
@@ -0,0 +1,163 @@
+/**
+ * @brief Dual numbers for forward-mode differentiation with respect to a single variable
+ *
+ * @file Dual.h
+ */
+#pragma once
+#include "Constants.h"
+#include <cmath>
+#include <ostream>
+
+namespace nupack {
+
+/******************************************************************************************/
+
+/// a += s * b for a plain derivative; gradient types over many variables provide their own overload
+template <class T, class U, NUPACK_IF(is_arithmetic<T>)>
+constexpr void add_scaled(T &a, T const &b, U s) {a += s * b;}
+
+/**
+ * @brief A value and its derivative with respect to one variable (here, the temperature)
+ * Arithmetic propagates the derivative by the chain rule; comparisons only look at the value.
+ * nupack::exp and nupack::log are functors over std:: so the transcendental functions are
+ * spelled dual_exp() and dual_log().
+ * The slope type S may instead be a gradient over many variables, such as a SparseGradient<T>.
+ */
+template <class T, class S=T>
+struct Dual {
+    using value_type = T;
+    T value = 0;
+    S slope{};
+
+    constexpr Dual() = default;
+    constexpr Dual(T v, S s) : value(v), slope(std::move(s)) {}
+    /// A constant: its derivative is 0
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    constexpr Dual(U v) : value(static_cast<T>(v)) {}
+
+    constexpr Dual operator-() const {return {-value, -slope};}
+    constexpr Dual operator+() const {return *this;}
+
+    constexpr Dual & operator+=(Dual const &o) {value += o.value; slope += o.slope; return *this;}
+    constexpr Dual & operator-=(Dual const &o) {value -= o.value; slope -= o.slope; return *this;}
+    // slopes are updated in place so that gradient slopes do not make temporaries
+    constexpr Dual & operator*=(Dual const &o) {
+        if (this == &o) return *this *= Dual(o);
+        slope *= o.value;
+        add_scaled(slope, o.slope, value);
+        value *= o.value;
+        return *this;
+    }
+    constexpr Dual & operator/=(Dual const &o) {
+        if (this == &o) return *this /= Dual(o);
+        slope /= o.value;
+        add_scaled(slope, o.slope, -value / (o.value * o.value));
+        value /= o.value;
+        return *this;
+    }
+
+    friend constexpr Dual operator+(Dual a, Dual const &b) {return a += b;}
+    friend constexpr Dual operator-(Dual a, Dual const &b) {return a -= b;}
+    friend constexpr Dual operator*(Dual a, Dual const &b) {return a *= b;}
+    friend constexpr Dual operator/(Dual a, Dual const &b) {return a /= b;}
+
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend constexpr Dual operator+(Dual a, U b) {a.value += b; return a;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend constexpr Dual operator+(U a, Dual b) {b.value += a; return b;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend constexpr Dual operator-(Dual a, U b) {a.value -= b; return a;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend constexpr Dual operator-(U a, Dual b) {b.value = a - b.value; b.slope *= -1; return b;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend constexpr Dual operator*(Dual a, U b) {a.value *= b; a.slope *= b; return a;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend constexpr Dual operator*(U a, Dual b) {b.value *= a; b.slope *= a; return b;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend constexpr Dual operator/(Dual a, U b) {a.value /= b; a.slope /= b; return a;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend constexpr Dual operator/(U a, Dual b) {b.slope *= -a / (b.value * b.value); b.value = a / b.value; return b;}
+
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    constexpr Dual & operator+=(U u) {value += u; return *this;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    constexpr Dual & operator-=(U u) {value -= u; return *this;}
+
+#define NUPACK_DUAL_COMPARE(op) \
+    friend constexpr bool operator op(Dual const &a, Dual const &b) {return a.value op b.value;} \
+    template <class U, NUPACK_IF(is_arithmetic<U>)> \
+    friend constexpr bool operator op(Dual const &a, U b) {return a.value op b;} \
+    template <class U, NUPACK_IF(is_arithmetic<U>)> \
+    friend constexpr bool operator op(U a, Dual const &b) {return a op b.value;}
+    NUPACK_DUAL_COMPARE(==); NUPACK_DUAL_COMPARE(!=); NUPACK_DUAL_COMPARE(<); NUPACK_DUAL_COMPARE(>); NUPACK_DUAL_COMPARE(<=); NUPACK_DUAL_COMPARE(>=);
+#undef NUPACK_DUAL_COMPARE
+
+    friend std::ostream & operator<<(std::ostream &os, Dual const &d) {return os << '(' << d.value << ", " << d.slope << ')';}
+};
+
+NUPACK_DEFINE_TEMPLATE(is_dual, Dual, class, class);
+
+/// Scalars and Duals are stored element-wise without a separate exponent
+template <class T>
+static constexpr bool is_scalar_like = std::is_scalar_v<decay<T>> || traits::is_dual<decay<T>>;
+
+/******************************************************************************************/
+
+/// Whether a derivative is finite; gradient types over many variables provide their own overload
+template <class T, NUPACK_IF(is_arithmetic<T>)>
+bool all_finite(T t) {return std::isfinite(t);}
+
+/// The value of a Dual, or the argument itself for a plain number
+template <class T>
+constexpr T const & primal(T const &t) {return t;}
+
+template <class T, class S>
+constexpr T const & primal(Dual<T, S> const &d) {return d.value;}
+
+/// The variable in which derivatives are taken: a Dual with slope 1 if T is a Dual in the temperature,
+/// otherwise a constant (a plain number, or a Dual whose gradient is over other variables)
+template <class T, class R>
+constexpr auto differentiation_variable(R t) {
+    if constexpr(traits::is_dual<T>) {
+        if constexpr(is_arithmetic<decltype(T::slope)>) return T(t, 1);
+        else return T(t);
+    } else return t;
+}
+
+/******************************************************************************************/
+
+/// Plain numbers pass through to std::exp and std::log
+template <class T, NUPACK_IF(is_arithmetic<T>)>
+auto dual_exp(T x) {return std::exp(x);}
+
+template <class T, NUPACK_IF(is_arithmetic<T>)>
+auto dual_log(T x) {return std::log(x);}
+
+template <class T, class S>
+Dual<T, S> dual_exp(Dual<T, S> const &x) {
+    T const e = std::exp(x.value);
+    return {e, e * x.slope};
+}
+
+template <class T, class S>
+Dual<T, S> dual_log(Dual<T, S> const &x) {return {std::log(x.value), x.slope / x.value};}
+
+/// Boltzmann factor from energy and beta, differentiated along with them
+template <class T, class S>
+Dual<T, S> boltzmann_factor(Dual<T, S> const &beta, Dual<T, S> const &energy) {return dual_exp(-beta * energy);}
+
+/// Energy from a Boltzmann factor, the inverse of boltzmann_factor()
+template <class T, class S>
+Dual<T, S> inverse_boltzmann(Dual<T, S> const &beta, Dual<T, S> const &factor) {return -dual_log(factor) / beta;}
+
+/******************************************************************************************/
+
+/// Compile-time constants such as *zero and *inf convert to a Dual with zero slope
+template <class T, class S, class N>
+struct ConvertConstant<Dual<T, S>, N, void_if<can_convert<decltype(ConstantConverter<T, N>()()), T>>> {
+    constexpr Dual<T, S> operator()() const {return Dual<T, S>(static_cast<T>(ConstantConverter<T, N>()()), S{});}
+};
+
+/******************************************************************************************/
+
+}
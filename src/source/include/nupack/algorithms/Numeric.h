@@ -281,10 +281,12 @@ void zero_memory(T *b, T const *e) {
     std::memset(static_cast<void *>(b), 0, reinterpret_cast<char const *>(e) - reinterpret_cast<char const *>(b));
 }
 
+/// Fill [b, e) with t, using memset if t is all zero bits and T is a POD the size of an unsigned integer
 template <class T>
 void contiguous_fill(T *b, T *e, T const t) {
-    if (std::is_pod_v<T> && reinterpret_cast<uint_of_size<sizeof(T)> const &>(t) == 0u) zero_memory(b, e);
-    else std::fill(b, e, t);
+    if constexpr(std::is_pod_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8))
+        if (reinterpret_cast<uint_of_size<sizeof(T)> const &>(t) == 0u) return zero_memory(b, e);
+    std::fill(b, e, t);
 }
 
 /******************************************************************************************/
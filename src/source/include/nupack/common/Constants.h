@@ -41,6 +41,8 @@ std::string reference_dna(std::size_t length);
 
 /// moles per liter of water from temperature in Kelvin
 real water_molarity(real t);
+/// derivative of water_molarity() with respect to temperature
+real water_molarity_slope(real t);
 
 // Stabilization energy from salt concentration for each loop
 real dna_salt_correction(real t, real na, real mg, bool long_helix=false);
@@ -10,6 +10,7 @@
 #include "Config.h"
 
 #include <mutex>
+#include <condition_variable>
 #include <chrono>
 #include <typeinfo>
 #include <sstream>
@@ -17,6 +18,8 @@
 #include <memory>
 #include <typeindex>
 #include <cctype>
+#include <atomic>
+#include <utility>
 
 namespace nupack {
 using namespace std::chrono_literals;
@@ -125,11 +128,117 @@ public:
 };
 
 extern thread_local std::shared_ptr<std::atomic<int>> ThreadLocalSignal;
-/// Throw a SignalError if there are any signals
+/// Throw a SignalError if there are any signals, or a JobInterrupted if the current job was stopped
 void throw_if_signal();
 
 void set_static_signal(int code);
 
 /******************************************************************************************/
 
+/// Why a job was stopped before finishing
+enum class JobStop : int {none, cancelled, timeout, memory};
+
+/// Exception thrown inside a job which was cancelled or exceeded one of its limits
+class JobInterrupted : public std::runtime_error {
+    JobStop reason_;
+    static char const * make_name(JobStop);
+public:
+    explicit JobInterrupted(JobStop r) : std::runtime_error(make_name(r)), reason_(r) {}
+    JobStop reason() const {return reason_;}
+};
+
+/**
+ * @brief Cooperative control of one job, shared by every thread working on it
+ * Work is counted in arbitrary units (DP cells for thermo programs); limits are checked
+ * whenever the job's threads call throw_if_signal()
+ */
+struct JobControl {
+    std::atomic<std::size_t> done{0}, total{0}, memory{0};
+    std::atomic<int> stop{int(JobStop::none)};
+    std::atomic<bool> paused{false};
+    chrono::steady_clock::time_point deadline = chrono::steady_clock::time_point::max();
+    std::size_t memory_limit = 0; // bytes, 0 for no limit
+    std::mutex mut; // only for waking paused threads
+    std::condition_variable resumed;
+
+    void request_stop(JobStop r) {
+        int none = int(JobStop::none);
+        if (stop.compare_exchange_strong(none, int(r))) wake();
+    }
+    JobStop stopped() const {return JobStop(stop.load(std::memory_order_relaxed));}
+
+    /// Make the job's threads wait at their next check until resume() or a stop
+    void pause() {paused.store(true);}
+    void resume() {paused.store(false); wake();}
+
+    /// Throw JobInterrupted if the job was cancelled or ran past its deadline, after waiting while it is paused
+    void check() {
+        if (paused.load()) {
+            std::unique_lock<std::mutex> lock(mut);
+            auto const go = [&] {return !paused.load() || stopped() != JobStop::none;};
+            if (deadline == chrono::steady_clock::time_point::max()) resumed.wait(lock, go);
+            else resumed.wait_until(lock, deadline, go);
+        }
+        if (stopped() == JobStop::none && chrono::steady_clock::now() > deadline) request_stop(JobStop::timeout);
+        if (auto r = stopped(); r != JobStop::none) throw JobInterrupted(r);
+    }
+
+    /// Charge bytes to the job, stopping it if that exceeds the memory limit
+    void acquire(std::size_t bytes) {
+        auto const m = memory.fetch_add(bytes) + bytes;
+        if (memory_limit && m > memory_limit) {request_stop(JobStop::memory); check();}
+    }
+    void release(std::size_t bytes) {memory.fetch_sub(bytes);}
+
+    /// Fraction of the expected work done so far
+    double progress() const {
+        auto const t = total.load(std::memory_order_relaxed);
+        return t ? std::min(1.0, double(done.load(std::memory_order_relaxed)) / t) : 0.0;
+    }
+
+private:
+    // taking the lock orders the notification after any waiter's test of its predicate
+    void wake() {{std::lock_guard<std::mutex> lock(mut);} resumed.notify_all();}
+};
+
+/// Job run by the current thread, if any; parallel executors pass it on to their workers
+extern thread_local std::shared_ptr<JobControl> ThreadLocalJob;
+
+/// Add expected work to the current job, if any
+inline void expect_progress(std::size_t n) {if (ThreadLocalJob) ThreadLocalJob->total.fetch_add(n, std::memory_order_relaxed);}
+/// Add finished work to the current job, if any
+inline void add_progress(std::size_t n) {if (ThreadLocalJob) ThreadLocalJob->done.fetch_add(n, std::memory_order_relaxed);}
+
+/// Charges memory to the current job, if any, for the lifetime of this object
+class JobMemory {
+    std::shared_ptr<JobControl> job;
+    std::size_t bytes = 0;
+public:
+    explicit JobMemory(std::size_t b) : job(ThreadLocalJob), bytes(b) {if (job) job->acquire(bytes);}
+    JobMemory(JobMemory const &) = delete;
+    JobMemory & operator=(JobMemory const &) = delete;
+    ~JobMemory() {if (job) job->release(bytes);}
+};
+
+/// Installs the calling thread's signal and job on another thread for the lifetime of this object
+class ThreadContext {
+    std::shared_ptr<std::atomic<int>> signal;
+    std::shared_ptr<JobControl> job;
+public:
+    ThreadContext() : signal(ThreadLocalSignal), job(ThreadLocalJob) {}
+
+    template <class F>
+    decltype(auto) operator()(F &&f) const {
+        if (ThreadLocalSignal == signal && ThreadLocalJob == job) return f();
+        struct Restore {
+            std::shared_ptr<std::atomic<int>> signal;
+            std::shared_ptr<JobControl> job;
+            ~Restore() {ThreadLocalSignal = std::move(signal); ThreadLocalJob = std::move(job);}
+        } restore{std::exchange(ThreadLocalSignal, signal), std::exchange(ThreadLocalJob, job)};
+        return f();
+    }
+};
+
+/******************************************************************************************/
+
 }
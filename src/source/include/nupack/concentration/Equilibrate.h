@@ -41,12 +41,26 @@ struct Output {
  */
 Output<real> equilibrate(Mat<real> const &A, Col<real> logb, Col<real> const &q, Options const &ops={});
 
+/// Same as above with a sparse (CSC) coefficient matrix, for systems with many complexes
+Output<real> equilibrate(SpMat<real> const &A, Col<real> logb, Col<real> const &q, Options const &ops={});
+
+/**
+ * @brief Solve equilibrium concentrations for a series of strand concentrations, e.g. a titration
+ * Merging of complexes and the least squares factorisation of A are shared by all points.
+ * Points are split into contiguous blocks solved in parallel, each point warm-started from the
+ * dual solution of the previous one, so neighbouring points should be similar.
+ * @param logb LOG of STRAND concentrations, one column per point
+ */
+vec<Output<real>> equilibrate_batch(Local const &env, Mat<real> const &A, Mat<real> const &logb, Col<real> const &q, Options const &ops={});
+vec<Output<real>> equilibrate_batch(Local const &env, SpMat<real> const &A, Mat<real> const &logb, Col<real> const &q, Options const &ops={});
+
 /**
  * @brief Solve equilibrium concentrations for complexes
+ * env: executor used to build the solver's Hessian for large numbers of complexes
  * indices: list of ordered indices of strands
  * logq: list of log partition functions (distinguishable)
  * x0: strand concentrations
  */
-Output<real> solve_complexes(vec<small_vec<uint>> const &indices, Col<real> logq, Col<real> x0, Options const &ops, bool rotational_correction=true, bool as_strands=true);
+Output<real> solve_complexes(Local const &env, vec<small_vec<uint>> const &indices, Col<real> logq, Col<real> x0, Options const &ops, bool rotational_correction=true, bool as_strands=true);
 
 }
@@ -10,6 +10,7 @@
 #include "../common/Random.h"
 #include "../math/BoundSolve.h"
 #include "../iteration/Search.h"
+#include "../execution/Local.h"
 #include "../reflect/SerializeMatrix.h"
 #include "../reflect/Serialize.h"
 #include <spdlog/spdlog.h>
@@ -19,13 +20,82 @@ namespace nupack::concentration {
 
 /******************************************************************************************/
 
-// where x is a vector and H is symmetric, return A.T * diag(x) * A
+// where x is a (non-negative) vector and H is symmetric, return A.T * diag(x) * A
 // this is probably the rate limiting step, complexity is (# strands)^2 (# complexes)
 template <class M, class V>
 void symmetric_mdm(M &H, M const &A, V const &x) {
-    H.set_size(A.n_cols, A.n_cols);
-    for (auto i : range(H.n_rows)) for (auto j : range(i+1))
-        H.at(j, i) = H.at(i, j) = accu(A.col(i) % x % A.col(j));
+    M const B = A.each_col() % la::sqrt(x);
+    H = B.t() * B; // Armadillo evaluates X^T X as a single BLAS syrk
+}
+
+namespace detail {
+
+// accumulate x_c a_c a_c^T into the lower triangle of H for complexes c in [begin, end)
+// At holds the strand counts of complex c in column c, with sorted row indices
+template <class T, class V>
+void sparse_mdm_block(Mat<T> &H, SpMat<T> const &At, V const &x, usize begin, usize end) {
+    for (auto c : range(begin, end)) {
+        auto const b = At.col_ptrs[c], e = At.col_ptrs[c+1];
+        for (auto p : range(b, e)) for (auto q : range(b, p+1))
+            H.at(At.row_indices[p], At.row_indices[q]) += At.values[p] * At.values[q] * x(c);
+    }
+}
+
+}
+
+// sparse version: complexity is sum_c (nonzeros in row c)^2
+template <class T, class V>
+void symmetric_mdm(Mat<T> &H, SpMat<T> const &A, V const &x) {
+    SpMat<T> const At = A.t();
+    H.zeros(A.n_cols, A.n_cols);
+    detail::sparse_mdm_block(H, At, x, 0, At.n_cols);
+    H = la::symmatl(H);
+}
+
+/// Minimum number of complexes handled by each task of a parallel symmetric_mdm()
+static constexpr usize MDMGrain = 2048;
+
+// parallel versions: each task reduces a contiguous block of complexes, and the blocks are summed
+template <class M, class V>
+void symmetric_mdm(Local const &env, M &H, M const &A, V const &x) {
+    usize const n = A.n_rows, n_tasks = min(n / MDMGrain, usize(env.n_workers()));
+    if (n_tasks < 2) return symmetric_mdm(H, A, x);
+    auto parts = env.map(n_tasks, 1, [&](auto const &, usize t) {
+        usize const b = t * n / n_tasks, e = (t + 1) * n / n_tasks;
+        M out;
+        symmetric_mdm(out, M(A.rows(b, e - 1)), V(x.rows(b, e - 1)));
+        return out;
+    });
+    H = std::move(parts[0]);
+    for (auto t : range(1, n_tasks)) H += parts[t];
+}
+
+template <class T, class V>
+void symmetric_mdm(Local const &env, Mat<T> &H, SpMat<T> const &A, V const &x) {
+    usize const n = A.n_rows, n_tasks = min(n / MDMGrain, usize(env.n_workers()));
+    if (n_tasks < 2) return symmetric_mdm(H, A, x);
+    SpMat<T> const At = A.t();
+    auto parts = env.map(n_tasks, 1, [&](auto const &, usize t) {
+        Mat<T> out(A.n_cols, A.n_cols, arma::fill::zeros);
+        detail::sparse_mdm_block(out, At, x, t * n / n_tasks, (t + 1) * n / n_tasks);
+        return out;
+    });
+    H = std::move(parts[0]);
+    for (auto t : range(1, n_tasks)) H += parts[t];
+    H = la::symmatl(H);
+}
+
+/******************************************************************************************/
+
+/// Least squares (or minimum norm, if underdetermined) solution of B x = b, where b may hold several columns
+template <class T, class V>
+V least_squares(Mat<T> const &B, V const &b) {return la::solve(B, b);}
+
+/// Sparse version via the normal equations, which only involve a dense (# strands)^2 system
+template <class T, class V>
+V least_squares(SpMat<T> const &B, V const &b) {
+    if (B.n_rows >= B.n_cols) return la::solve(Mat<T>(B.t() * B), V(B.t() * b));
+    return B.t() * V(la::solve(Mat<T>(B * B.t()), b));
 }
 
 
@@ -36,13 +106,13 @@ void symmetric_mdm(M &H, M const &A, V const &x) {
 // \log b - \log a - q = \hat{A}^T \lambda + \log ( 1^T Y ) + \frac{ (\lambda - \lambda^0)^T (A^T Y - \hat{A} d(1^T Y)) } { 1^T Y  }
 
 template <class T, class M>
-Output<T> equilibrate_lse(M const &A, Col<T> const &logb, Col<T> const &logq, Options ops) {
+Output<T> equilibrate_lse(M const &A, Col<T> const &logb, Col<T> const &logq, Options ops, Col<T> const &dual={}) {
     NUPACK_ASSERT(logb.is_finite(), logb, "Strand concentrations should be finite");
     NUPACK_ASSERT(logq.is_finite(), logq, "Partition functions should be finite");
     NUPACK_REQUIRE(A.min(), >=, 0, A, "Coefficient matrix should be non-negative");
 
     Output<T> out;
-    auto &y = out.dual_solution = la::solve(A, la::log(A * la::exp(logb)) - logq);
+    auto &y = out.dual_solution = dual.empty() ? Col<T>(la::solve(A, la::log(A * la::exp(logb)) - logq)) : dual;
     auto &x = out.solution;
     la::uvec c(logb.n_cols);
     M X(A.n_rows, A.n_cols), Y, Alog = la::log(A);
@@ -71,23 +141,62 @@ Output<T> equilibrate_lse(M const &A, Col<T> const &logb, Col<T> const &logq, Op
     return out;
 }
 
+// Same iteration with a sparse A: Y shares the sparsity pattern of A so each step is O(nonzeros)
+template <class T>
+Output<T> equilibrate_lse(SpMat<T> const &A, Col<T> const &logb, Col<T> const &logq, Options ops, Col<T> const &dual={}) {
+    NUPACK_ASSERT(logb.is_finite(), logb, "Strand concentrations should be finite");
+    NUPACK_ASSERT(logq.is_finite(), logq, "Partition functions should be finite");
+    NUPACK_REQUIRE(A.min(), >=, 0, A, "Coefficient matrix should be non-negative");
+
+    Output<T> out;
+    auto &y = out.dual_solution = dual.empty() ? least_squares(A, Col<T>(la::log(A * la::exp(logb)) - logq)) : dual;
+    auto &x = out.solution;
+    la::uvec const rows(A.row_indices, A.n_nonzero), cols(A.col_ptrs, A.n_cols + 1);
+    Col<T> values(A.n_nonzero), rhs(A.n_cols), error, xc(A.n_cols);
+    Mat<T> G;
+
+    for (out.iters = 0; out.iters != ops.max_iters; ++out.iters) {
+        x = A * y + logq;
+        for (auto j : range(A.n_cols)) {
+            auto const b = A.col_ptrs[j], e = A.col_ptrs[j+1];
+            auto c = b; // nonzero with the largest log A + x, as index_max in the dense version
+            for (auto p : range(b, e))
+                if (std::log(A.values[p]) + x(A.row_indices[p]) > std::log(A.values[c]) + x(A.row_indices[c])) c = p;
+            xc(j) = b == e ? 0 : -x(A.row_indices[c]);
+            rhs(j) = 0;
+            for (auto p : range(b, e)) rhs(j) += (values(p) = A.values[p] * std::exp(x(A.row_indices[p]) + xc(j)));
+        }
+
+        error = logb + xc - la::log(rhs);
+        if (la::max(la::abs(error)) < ops.tolerance) {out.converged = true; break;}
+
+        G = Mat<T>(SpMat<T>(rows, cols, values, A.n_rows, A.n_cols).t() * A);
+        rhs %= error;
+        y += la::solve(G, rhs);
+        x = A * y + logq;
+    }
+    x = la::exp(x);
+    return out;
+}
+
 /******************************************************************************************/
 
 // This one converges nicely but isn't very guarded against exponentiation overflow
+// dual (a starting dual solution) and given_x0 (complex concentrations matching logb) are computed if empty
 template <class T, class M>
-Output<T> equilibrate_cd(M const &A, Col<T> const &logb, Col<T> const &logq, Options ops) {
+Output<T> equilibrate_cd(Local const &env, M const &A, Col<T> const &logb, Col<T> const &logq, Options ops, Col<T> const &dual={}, Col<T> const &given_x0={}) {
     Output<T> out;
-    auto &y = out.dual_solution = la::solve(A, la::log(A * la::exp(logb)) - logq);
+    auto &y = out.dual_solution = dual.empty() ? least_squares(A, Col<T>(la::log(A * la::exp(logb)) - logq)) : dual;
 
     Mat<T> H, V, AV;
     Col<T> e, vy, logx = A * y + logq;
     auto &x = out.solution = la::exp(logx);
 
-    Col<T> const x0 = la::solve(A.t(), la::exp(logb));
+    Col<T> const x0 = given_x0.empty() ? least_squares(M(A.t()), Col<T>(la::exp(logb))) : given_x0;
 
     for (out.iters = 0; out.iters != ops.max_iters; ++out.iters) {
         if (out.iters % logb.n_rows == 0) { // O(m n^2), done every n is O(m n)
-            symmetric_mdm(H, A, x);
+            symmetric_mdm(env, H, A, x);
             NUPACK_ASSERT(la::eig_sym(e, V, H), "eigendecomposition failed", H, x);
             // V.clean(1e-12); // could remove small entries just in case there's noise
             AV = A * V;
@@ -261,11 +370,23 @@ V initial_dual_guess(Method in, M const &A, V const &x0, V const &q, V const &rh
 
     // Weight lower free energy complexes more for a least squares initial guess
     V const weight = arma::exp(q - q.max());
-    M const AwA = A.t() * la::diagmat(weight) * A;
+    M AwA;
+    symmetric_mdm(AwA, A, weight); // same as A.t() * la::diagmat(weight) * A
 
     return la::solve(AwA, A.t() * (weight % (c - q)));
 }
 
+/// Uniform initial guess for a sparse A, optionally expressed in an orthonormal basis Q of its row space
+template <class T>
+Col<T> initial_dual_guess(SpMat<T> const &A, Mat<T> const &Q, Col<T> const &q) {
+    Col<T> const weight = arma::exp(q - q.max());
+    Mat<T> AwA;
+    symmetric_mdm(AwA, A, weight);
+    Col<T> rhs = A.t() * (weight % (1 - q));
+    if (!Q.empty()) {AwA = Q.t() * AwA * Q; rhs = Q.t() * rhs;}
+    return la::solve(AwA, rhs);
+}
+
 
 /**
  * @brief Solve equilibrium concentrations
@@ -276,8 +397,9 @@ V initial_dual_guess(Method in, M const &A, V const &x0, V const &q, V const &rh
  * @param ops solving options
  * @return V equilibrated concentrations
  */
-template <class T>
-Output<T> equilibrate_gradient(Mat<T> A, Col<T> const &x0, Col<T> const &q, Options const &ops) {
+template <class T, class M>
+Output<T> equilibrate_gradient(Local const &env, M A, Col<T> const &x0, Col<T> const &q, Options const &ops, Col<T> const &dual={}) {
+    constexpr bool sparse = la::is_sparse<M>;
     static auto logger = spdlog::get("concentration");
     NUPACK_ALL_EQUAL("Inconsistent number of complexes", x0.n_rows, q.n_rows, A.n_rows);
 
@@ -286,12 +408,27 @@ Output<T> equilibrate_gradient(Mat<T> A, Col<T> const &x0, Col<T> const &q, Opti
 
     if (!len(x0)) return {x0, 0, 0, true};
 
-    Mat<T> orig_A, orth_A;
+    M orig_A;
+    Mat<T> orth_A;
     if (ops.orthogonalize) {
-        orig_A = A;
-        orth_A = orth(A.t());
-        A = A * orth_A;
+        // A sparse A is kept in the strand basis and the dual is mapped through orth_A instead.
+        // orth(A^T A) spans the same space as orth(A^T) but only needs the small Gram matrix.
+        if constexpr(sparse) orth_A = orth(Mat<T>(A.t() * A));
+        else {
+            orig_A = A;
+            orth_A = orth(A.t());
+            A = A * orth_A;
+        }
     }
+    // Map dual vectors to and from the strand basis; identity unless A was kept sparse
+    auto const lift = [&](Col<T> const &y) -> Col<T> {
+        if (sparse && ops.orthogonalize) return orth_A * y;
+        return y;
+    };
+    auto const project = [&](Col<T> const &v) -> Col<T> {
+        if (sparse && ops.orthogonalize) return orth_A.t() * v;
+        return v;
+    };
 
     // Direction finder with minimum radius delta
     auto direction = [dmin=ops.delta_min](auto const &...ts) {
@@ -305,9 +442,9 @@ Output<T> equilibrate_gradient(Mat<T> A, Col<T> const &x0, Col<T> const &q, Opti
     real error;
     bool good = false;
     // Negative total concentrations of each strand type in the chosen basis
-    Col<T> const rhs = -(A.t() * x0);
+    Col<T> const rhs = -project(A.t() * x0);
     // Negative total concentrations of each strand type in the normal basis
-    Col<T> const normalization = 1 / ((ops.orthogonalize ? orig_A : A).t() * x0);
+    Col<T> const normalization = 1 / ((ops.orthogonalize && !sparse ? orig_A : A).t() * x0);
     NUPACK_ASSERT(normalization.is_finite() && normalization.min() > 0, normalization);
     // Convergence criterion based on gradient norm
     auto condition = [&] (auto const &sys, auto const &grad, auto const &...) {
@@ -321,23 +458,30 @@ Output<T> equilibrate_gradient(Mat<T> A, Col<T> const &x0, Col<T> const &q, Opti
         // In the future, 1e100 is a bit arbitrary.
         // This is done to prevent infinity from occurring during intermediate solution
         // It would be better to constrain the dual vector y to be in a reasonable regime.
-        x = la::clamp(la::exp(A * y + q), std::numeric_limits<real>::min(), 1e100);
-        NUPACK_ASSERT(x.is_finite(), x, A, y, q, A * y + q, n);
+        x = la::clamp(la::exp(A * lift(y) + q), std::numeric_limits<real>::min(), 1e100);
+        NUPACK_ASSERT(x.is_finite(), x, A, y, q, A * lift(y) + q, n);
     };
     // Function to calculate objective from primal and dual
     auto objective = [&](auto const &x, auto const &y) {return accu(x) + dot(y, rhs);};
 
-    auto sys = dual_system(initial_dual_guess(ops.method, A, x0, q, rhs), primal, objective);
+    auto guess = [&]() -> Col<T> {
+        // a given dual solution is in the strand basis, and only its row space component matters
+        if (!dual.empty()) return ops.orthogonalize ? Col<T>(orth_A.t() * dual) : dual;
+        if constexpr(sparse) return initial_dual_guess(A, orth_A, q);
+        else return initial_dual_guess(ops.method, A, x0, q, rhs);
+    };
+    auto sys = dual_system(guess(), primal, objective);
 
     // Function to calculate gradient in dual space from system
     auto gradient = [&](auto &grad, auto const &s) {
-        grad = A.t() * s.primal + rhs;
+        grad = project(A.t() * s.primal) + rhs;
         NUPACK_ASSERT(grad.is_finite(), s.primal, n);
     };
     // Function to calculate gradient in dual space from system
     // this is probably the rate limiting step, complexity is (# strands)^2 (# complexes)
     auto hessian = [&](auto &H, auto const &s) {
-        symmetric_mdm(H, A, s.primal);
+        symmetric_mdm(env, H, A, s.primal);
+        if (sparse && ops.orthogonalize) H = orth_A.t() * H * orth_A;
         NUPACK_ASSERT(H.is_finite(), s.primal, n);
     }; // same as H = A.t() * la::diagmat(s.primal) * A;
     // Function to adjust trust region radius and return if the new values should be accepted
@@ -364,12 +508,15 @@ Output<T> equilibrate_gradient(Mat<T> A, Col<T> const &x0, Col<T> const &q, Opti
 
 /******************************************************************************************/
 
-template <class T>
-Output<T> equilibrate_finite(Mat<T> const &A, Col<T> const &logb, Col<T> const &logq, Options const &ops) {
+/// A may be a dense Mat<T> or a sparse SpMat<T>; the latter scales with its number of nonzeros
+/// dual optionally warm-starts the solver; x0 optionally gives complex concentrations consistent with logb
+/// env parallelizes the Hessian assembly (symmetric_mdm) of the cd and trust region solvers for many complexes
+template <class T, class M>
+Output<T> equilibrate_finite(Local const &env, M const &A, Col<T> const &logb, Col<T> const &logq, Options const &ops, Col<T> const &dual={}, Col<T> const &x0={}) {
     switch (ops.method) {
-        case Method::cd: return equilibrate_cd<T>(A, logb, logq, ops);
-        case Method::fit: return equilibrate_lse<T>(A, logb, logq, ops);
-        default: return equilibrate_gradient(A, Col<T>(la::solve(A.t(), la::exp(logb))), logq, ops);
+        case Method::cd: return equilibrate_cd<T>(env, A, logb, logq, ops, dual, x0);
+        case Method::fit: return equilibrate_lse<T>(A, logb, logq, ops, dual);
+        default: return equilibrate_gradient<T>(env, A, x0.empty() ? least_squares(M(A.t()), Col<T>(la::exp(logb))) : x0, logq, ops, dual);
     }
 }
 
@@ -0,0 +1,86 @@
+#pragma once
+#include "TypeImports.h"
+#include "../standard/Map.h"
+#include <mutex>
+#include <shared_mutex>
+
+namespace nupack { namespace newdesign {
+
+struct ThermoEnviron;
+
+/**
+ * @brief fitted runtime in seconds of one thermo evaluation of a complex with
+ * n nucleotides, t(n) = cubic n^3 + linear n + constant. The linear term absorbs
+ * the per-diagonal synchronization of a parallel evaluation.
+ */
+struct ExecutionCost {
+    real cubic = 0, linear = 0, constant = 0;
+
+    real operator()(real n) const {return cubic * n * n * n + linear * n + constant;}
+
+    NUPACK_REFLECT(ExecutionCost, cubic, linear, constant);
+};
+
+/// serial and parallel runtimes for one (ensemble, pair probability, worker count) setting
+struct ExecutionProfile {
+    ExecutionCost serial, parallel;
+    NUPACK_REFLECT(ExecutionProfile, serial, parallel);
+};
+
+/**
+ * @brief Host-specific model predicting how long a design thermo evaluation takes serially
+ * and on a parallel executor. Profiles are calibrated by timing a few random sequences the
+ * first time a setting is needed, and are saved to path() so that later runs on the same
+ * host reuse them. Only sizes within the calibrated range (48-240 nt) are predicted from
+ * the fit; outside it the fixed 500 nt crossover is used.
+ */
+class CostModel {
+    mutable std::shared_mutex mut;
+    std::mutex calibration;
+    Map<string, ExecutionProfile> profiles;
+    string file;
+
+    void save() const;
+
+public:
+    explicit CostModel(string path);
+
+    /// $NUPACK_COST_MODEL if set, else $HOME/.nupack/thermo-costs.json, else a local file
+    static string default_path();
+    /// process-wide model persisted at default_path()
+    static CostModel & global();
+
+    string const & path() const {return file;}
+
+    /// profile for this executor and model setting, calibrating it on a dedicated thread if it is not known yet
+    ExecutionProfile profile(Local const &env, ThermoEnviron &t_env, bool pairs);
+
+    /// whether env is predicted to evaluate a complex of n nucleotides faster than a serial executor
+    bool parallel_faster(Local const &env, ThermoEnviron &t_env, std::size_t n, bool pairs);
+
+    /**
+     * @brief whether a batch of independent evaluations of the given sizes finishes sooner
+     * when the complexes run concurrently, each serially, than when they run one at a time,
+     * each using every worker of env
+     */
+    bool prefer_outer(Local const &env, ThermoEnviron &t_env, vec<std::size_t> const &sizes, bool pairs);
+};
+
+/******************************************************************************************/
+
+/**
+ * @brief replace a shared environment with a serial one if the cost model
+ * predicts that evaluating the complex (or subcomplex) serially is faster.
+ *
+ * @param env an environment
+ * @param s either a complex or a decomposition node
+ * @param t_env the thermo environment the evaluation will use
+ * @param pairs whether pair probabilities (rather than only the partition function) are needed
+ */
+template <class S>
+Local threshold(Local const &env, S const &s, ThermoEnviron &t_env, bool pairs) {
+    if (env.n_workers() == 1) return env;
+    return CostModel::global().parallel_faster(env, t_env, len(s), pairs) ? env : Local();
+}
+
+}}
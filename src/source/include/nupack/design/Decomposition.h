@@ -1,6 +1,7 @@
 #pragma once
 #include "Split.h"
 #include "Models.h"
+#include "CostModel.h"
 #include "ThermoWrapper.h"
 #include "Defect.h"
 #include "Granularity.h"
@@ -18,23 +19,6 @@ struct DecompositionParameters {
     NUPACK_REFLECT(DecompositionParameters, H_split, N_split, f_split, f_sparse, dG_clamp);
 };
 
-/**
- * @brief replace a shared environment with a serial one if the size of the
- * complex (or subcomplex) is smaller than the threshold.
- *
- * @tparam V environment type
- * @tparam S a complex or decomposition node type
- * @param v an environment
- * @param s either a complex or a decomposition node
- */
-template <class V, class S>
-auto threshold(V const &v, S const &s) {
-    static constexpr uint thresh = 500;
-    if (v.n_workers() == 1) return v;
-    if (len(s) <= thresh) return Local();
-    return v;
-}
-
 struct ComplexNode;
 using PairedChildren = std::pair<SplitPoint, std::pair<ComplexNode, ComplexNode>>;
 
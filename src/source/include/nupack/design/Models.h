@@ -3,6 +3,7 @@
 #include "TypeImports.h"
 #include "../thermo/CachedModel.h"
 #include "../model/Model.h"
+#include "../standard/Map.h"
 #include <shared_mutex>
 
 namespace nupack::newdesign {
@@ -40,10 +41,46 @@ struct CopyableMutex {
     std::shared_mutex mutable mut;
 };
 
+/**
+ * @brief Log partition functions keyed by complex up to rotation
+ * Entries are grouped by CanonicalComplex::hash(), so a lookup by Complex computes the hash of
+ * its lowest rotation once and compares the stored complexes against it directly, without
+ * building the rotation or a handle.
+ */
+class PfuncTable {
+    HashMap<std::size_t, small_vec<std::pair<CanonicalComplex, real>, 1>> buckets;
+
+public:
+    NUPACK_REFLECT(PfuncTable, buckets);
+
+    Optional<real> find(::nupack::Complex const &c) const {
+        auto const [h, shift] = CanonicalComplex::probe(c);
+        if (auto it = buckets.find(h); it != buckets.end())
+            for (auto const &[k, v] : it->second) if (k.matches(c, shift)) return v;
+        return {};
+    }
+
+    /// Add an entry, which must not be present already
+    void insert(CanonicalComplex k, real v) {buckets[k.hash()].emplace_back(std::move(k), v);}
+
+    vec<std::pair<CanonicalComplex, real>> save_repr() const {
+        vec<std::pair<CanonicalComplex, real>> out;
+        for (auto const &b : buckets) out.insert(out.end(), b.second.begin(), b.second.end());
+        return out;
+    }
+
+    /// Serialized as a list of (complex, log pfunc) entries, like the map this replaced
+    void load_repr(vec<std::pair<CanonicalComplex, real>> v) {
+        buckets.clear();
+        for (auto &[k, x] : v) insert(std::move(k), x);
+    }
+};
+
 struct ThermoEnviron {
     ModelsTuple models;
     DesignCacheVariant cache;
-    std::map<::nupack::Complex, real> log_pfuncs;
+    ComplexTable complexes; // interns the keys of log_pfuncs, which are freed with this environment
+    PfuncTable log_pfuncs;
     CopyableMutex mut;
 
     ThermoEnviron() = default;
@@ -65,11 +102,12 @@ struct ThermoEnviron {
  * @brief Maintains cache of all models needed during design to avoid constantly
  * recreating the model. Furthermore, keeps 32-bit and 64-bit versions of the
  * same model together to support model fallback operations in a relatively
- * seamless manner when calling thermo code.
+ * seamless manner when calling thermo code. Models are keyed by their fingerprint,
+ * so a lookup hashes 128 bits instead of comparing every parameter.
  *
  */
-class ModelMap : MemberOrdered {
-    mutable std::map<Model<real>, ThermoEnviron> mod_map;
+class ModelMap : MemberComparable {
+    mutable HashMap<Fingerprint, ThermoEnviron> mod_map;
 
 public:
     NUPACK_REFLECT(ModelMap, mod_map);
@@ -83,6 +121,8 @@ public:
      * @return reference to the requested pair of models
      */
     ThermoEnviron & get(Model<real> const & key) const;
+    /// Environment for a model fingerprint if that model has been seen, else nullptr
+    ThermoEnviron * find(Fingerprint const &key) const;
     auto const &cached_models(Model<real> const & key) const {return get(key).models;}
 
     void create_caches(std::size_t ram);
@@ -22,11 +22,14 @@ struct Local {
     constexpr auto even_split() const {return EvenSplit();}
 
     Variant<SerialImpl, SharedImpl> executor;
-    Local(uint n=1) : executor(n == 1 ? SerialImpl() : Variant<SerialImpl, SharedImpl>(SharedImpl(n))) {}
+    /// If numa is set, a parallel executor pins its workers across NUMA nodes and dynamic
+    /// programs first-touch their matrices from those workers
+    Local(uint n=1, bool numa=false) : executor(n == 1 ? SerialImpl() : Variant<SerialImpl, SharedImpl>(SharedImpl(n, numa))) {}
 
     NUPACK_REFLECT(Local, executor);
 
     auto n_workers() const {return fork(executor, [](auto const &ex) -> uint {return ex.n_workers();});}
+    bool numa() const {return fork(executor, [](auto const &ex) -> bool {return ex.numa();});}
 
     /**
      * @brief Parallelize a functor across a container
@@ -69,6 +72,18 @@ struct Local {
         return out;
     }
 
+    /**
+     * @brief Run a functor on each node of a DAG after all of its predecessors
+     * @param pending: number of predecessors of each node
+     * @param roots: nodes without predecessors, started in the given order
+     * @param next: functor returning a range of the nodes that a given node precedes
+     * @param f: functor returning void from (*this, node)
+     */
+    template <class N, class F>
+    void dataflow(vec<uint> const &pending, vec<uint> const &roots, N const &next, F const &f) const {
+        fork(executor, [&](auto const &ex) {ex.dataflow(*this, pending, roots, next, f);});
+    }
+
     template <class R=DefaultReducer, class V>
     auto reduce(V const &v, R const &r=DefaultReducer()) const {
         return fork(executor, [&](auto const &ex) {return ex.reduce(v, r);});
@@ -0,0 +1,68 @@
+/**
+ * @brief Helpers for running on multi-socket (NUMA) hosts: worker pinning and page placement
+ *
+ * @file Numa.h
+ */
+#pragma once
+#include "../standard/Vec.h"
+
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_observer.h>
+
+namespace nupack::numa {
+
+/******************************************************************************************/
+
+/// Logical CPUs ordered round-robin across NUMA nodes (node 0 cpu, node 1 cpu, ...)
+/// Only CPUs in the affinity mask the process started with are included
+/// Falls back to the allowed CPUs, else 0, 1, ... hardware_concurrency() - 1, when no topology is available
+vec<int> const & cpu_order();
+
+/// Number of NUMA nodes with allowed CPUs detected (1 if no topology is available)
+std::size_t n_nodes();
+
+/// Restrict the calling thread to one logical CPU, return whether it succeeded
+/// The thread's affinity from before its first pin is kept for unpin_this_thread()
+bool pin_this_thread(int cpu);
+
+/// Restore the calling thread's affinity from before pin_this_thread(), if it was pinned
+void unpin_this_thread();
+
+/// Give the whole pages within [p, p + bytes) back to the OS so that they are placed on
+/// the node of whichever thread next writes them. The contents of those pages become zero.
+void release_pages(void *p, std::size_t bytes);
+
+/// Set the whole pages within [p, p + bytes) to be allocated round-robin across the NUMA nodes
+/// with allowed CPUs when they are next touched (an mbind MPOL_INTERLEAVE policy).
+/// Return whether the policy was set, which needs Linux and more than one node.
+bool interleave_pages(void *p, std::size_t bytes);
+
+/// Offset into cpu_order() for the next arena to be pinned, advanced by its number of slots
+std::size_t next_pinning_offset(std::size_t slots);
+
+/******************************************************************************************/
+
+/// Pins each worker entering an arena to the CPU for its arena slot, so that consecutive
+/// slots alternate between nodes and a static partition of work interleaves across them.
+/// Each arena starts at its own offset into cpu_order(), so that arenas which exist at the same
+/// time use different CPUs until there are more slots than CPUs.
+/// A worker leaving the arena gets its previous affinity back, since it may next serve another arena.
+class Pinning : public tbb::task_scheduler_observer {
+    std::size_t offset;
+public:
+    explicit Pinning(tbb::task_arena &a) : tbb::task_scheduler_observer(a),
+        offset(next_pinning_offset(a.max_concurrency())) {observe(true);}
+    ~Pinning() {observe(false);}
+
+    void on_scheduler_entry(bool is_worker) override {
+        auto const &cpus = cpu_order();
+        auto const slot = tbb::this_task_arena::current_thread_index();
+        if (is_worker && slot >= 0 && !cpus.empty()) pin_this_thread(cpus[(offset + slot) % cpus.size()]);
+    }
+
+    void on_scheduler_exit(bool is_worker) override {if (is_worker) unpin_this_thread();}
+};
+
+/******************************************************************************************/
+
+}
@@ -2,6 +2,7 @@
 #include "Operations.h"
 #include "../iteration/Patterns.h"
 #include "../iteration/Range.h"
+#include "../standard/Vec.h"
 
 namespace nupack {
 
@@ -15,6 +16,18 @@ struct SerialImpl {
         return false;
     }
 
+    /// Run f(env, k) for each node k of a DAG in a topological order, depth first from the roots in order
+    template <class E, class N, class F>
+    void dataflow(E &&env, vec<uint> pending, vec<uint> const &roots, N const &next, F const &f) const {
+        vec<uint> stack(roots.rbegin(), roots.rend());
+        while (!stack.empty()) {
+            auto const k = stack.back();
+            stack.pop_back();
+            f(env, k);
+            for (auto p : next(k)) if (!--pending[p]) stack.push_back(p);
+        }
+    }
+
     template <class R, class V>
     auto reduce(V const &v, R const &r) const {
         return std::accumulate(begin_of(v), end_of(v), value_type_of<V>(), r);
@@ -27,6 +40,7 @@ struct SerialImpl {
     }
 
     constexpr auto n_workers() const {return 1u;}
+    constexpr bool numa() const {return false;}
 };
 
 /******************************************************************************************/
@@ -1,15 +1,21 @@
 #pragma once
 #include "Operations.h"
+#include "Numa.h"
 #include "../standard/Vec.h"
 #include "../iteration/Range.h"
 
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 #include "tbb/partitioner.h"
-#include <tbb/task_scheduler_init.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 #include <tbb/cache_aligned_allocator.h>
 #include <thread>
 #include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
 
 namespace nupack {
 
@@ -23,21 +29,43 @@ inline auto default_thread_number() {return std::min<int>(TotalCPU, std::thread:
 
 /******************************************************************************************/
 
+/**
+ * @brief Shared-memory executor backed by its own tbb::task_arena
+ * Each SharedImpl (and its copies) runs work in an isolated arena limited to its thread count,
+ * so independent executors in one process split cores instead of oversubscribing one pool.
+ * Nested spread/map calls from within a task run in the same arena; each parallel region is
+ * isolated so a thread waiting on an inner loop only picks up work from that loop.
+ * Tasks see the signal and job (see ThreadContext) of the thread which started the loop.
+ */
 struct SharedImpl {
     struct State {
         using simple_type = True;
         State() = default;
-        State(usize n) : contents(std::make_unique<tbb::task_scheduler_init const>(n)), max(n) {}
+        State(usize n, bool numa=false) : max(n) {make(numa);}
 
-        std::unique_ptr<tbb::task_scheduler_init const> contents;
+        std::unique_ptr<tbb::task_arena> contents;
+        std::unique_ptr<numa::Pinning> pinning; // declared after the arena so that it stops observing first
         std::mutex mut;
         usize max;
 
-        auto save_repr() const {return make_members(max);}
-        void load_repr(usize m) {max = m; contents = std::make_unique<tbb::task_scheduler_init const>(max);}
+        void make(bool numa) {
+            pinning.reset();
+            contents = std::make_unique<tbb::task_arena>(int(max));
+            if (numa) {contents->initialize(); pinning = std::make_unique<numa::Pinning>(*contents);}
+        }
+
+        auto save_repr() const {return make_members(max, bool(pinning));}
+        void load_repr(usize m, bool numa) {max = m; make(numa);}
     };
 
-    SharedImpl(usize n=0) : state(std::make_shared<State>(n ? n : default_thread_number())) {}
+    /// If numa is set, workers are pinned to CPUs alternating between NUMA nodes (see numa::Pinning)
+    SharedImpl(usize n=0, bool numa=false) : state(std::make_shared<State>(n ? n : default_thread_number(), numa)) {}
+
+    /// Run a functor inside this executor's arena, isolated from any enclosing parallel region
+    template <class F>
+    decltype(auto) execute(F &&f) const {
+        return state->contents->execute([&]() -> decltype(auto) {return tbb::this_task_arena::isolate(f);});
+    }
 
     template <class E, class V, class F>
     bool spread(E &&env, V const &v, GrainSize g, F const &f, OrderedSplit) const {
@@ -47,24 +75,88 @@ struct SharedImpl {
 #       else
             auto &&p = tbb::static_partitioner();
 #       endif
-        tbb::parallel_for(usize(0), usize(len(v)), g.value, [&] (usize i) {f(env, v[count++], i);}, p);
+        ThreadContext const context;
+        execute([&] {
+            tbb::parallel_for(usize(0), usize(len(v)), g.value, [&] (usize i) {context([&] {f(env, v[count++], i);});}, p);
+        });
         return false;
     }
 
+    /// With numa, parallel for split into one contiguous chunk per arena slot, the same for every call
+    /// of the same length, so that a slot keeps working on the same cells on the same CPU.
+    /// Otherwise the same as any other split.
+    template <class E, class V, class F>
+    bool spread(E &&env, V const &v, GrainSize g, F const &f, EvenSplit) const {
+#       if TBB_INTERFACE_VERSION >= 9100
+        if (numa()) {
+            ThreadContext const context;
+            execute([&] {
+                tbb::parallel_for(tbb::blocked_range<usize>(0u, len(v), g.value),
+                    [&](auto const &b) {context([&] {for (auto i : iterators(b)) f(env, v[i], i);});}, tbb::static_partitioner());
+            });
+            return false;
+        }
+#       endif
+        return spread(env, v, g, f, AffinitySplit());
+    }
+
     /// Parallel for with manually specified granularity
-    template <class E, class V, class F, class P, NUPACK_IF(!is_same<P, OrderedSplit>)>
+    template <class E, class V, class F, class P, NUPACK_IF(!is_same<P, OrderedSplit> && !is_same<P, EvenSplit>)>
     bool spread(E &&env, V const &v, GrainSize g, F const &f, P) const {
-        tbb::parallel_for(tbb::blocked_range<usize>(0u, len(v), g.value),
-            [&](auto const &b) {for (auto i : iterators(b)) f(env, v[i], i);}, tbb::auto_partitioner());
+        ThreadContext const context;
+        execute([&] {
+            tbb::parallel_for(tbb::blocked_range<usize>(0u, len(v), g.value),
+                [&](auto const &b) {context([&] {for (auto i : iterators(b)) f(env, v[i], i);});}, tbb::auto_partitioner());
+        });
         return false;
     }
 
+    /**
+     * @brief Run f(env, k) for each node k of a DAG, each once all of its predecessors have finished
+     * Each node is spawned as a task by whichever of its predecessors finishes last, so no worker
+     * ever blocks waiting for a node to become ready. If any f throws, no further nodes are started
+     * and the first exception is rethrown.
+     * @param pending number of predecessors of each node
+     * @param roots nodes without predecessors, spawned in the given order
+     * @param next functor returning a range of the nodes that a given node precedes
+     */
+    template <class E, class N, class F>
+    void dataflow(E &&env, vec<uint> const &pending, vec<uint> const &roots, N const &next, F const &f) const {
+        std::unique_ptr<std::atomic<uint>[]> counts(new std::atomic<uint>[len(pending)]);
+        for (auto k : indices(pending)) counts[k].store(pending[k], std::memory_order_relaxed);
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex mut;
+        ThreadContext const context;
+        execute([&] {
+            tbb::task_group group;
+            std::function<void(uint)> spawn = [&](uint k) {
+                group.run([&, k] {
+                    if (failed.load()) return;
+                    try {context([&] {f(env, k);});}
+                    catch (...) {
+                        std::lock_guard lock(mut);
+                        if (!error) error = std::current_exception();
+                        failed.store(true);
+                        return;
+                    }
+                    for (auto p : next(k)) if (counts[p].fetch_sub(1) == 1) spawn(p);
+                });
+            };
+            for (auto k : roots) spawn(k);
+            group.wait();
+        });
+        if (error) std::rethrow_exception(error);
+    }
+
     template <class R, class V>
     auto reduce(V const &v, R const &r) const {
         auto range = tbb::blocked_range<const_iterator_of<V>>(begin_of(v), end_of(v));
         auto const acc = DefaultAccumulator();
-        return tbb::parallel_reduce(range, value_type_of<V>(),
-            [&r, &acc](auto const &a, auto const &o) {return acc(begin_of(a), end_of(a), o, r);}, r);
+        return execute([&] {
+            return tbb::parallel_reduce(range, value_type_of<V>(),
+                [&r, &acc](auto const &a, auto const &o) {return acc(begin_of(a), end_of(a), o, r);}, r);
+        });
     }
 
     template <class E, class V, class F, class T>
@@ -75,6 +167,7 @@ struct SharedImpl {
     }
 
     auto n_workers() const {return state->max;}
+    bool numa() const {return bool(state->pinning);}
 
     NUPACK_REFLECT(SharedImpl, state);
 
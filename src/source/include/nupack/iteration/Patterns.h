@@ -171,20 +171,25 @@ std::size_t compute_necklaces(V &&v, uint const n_elements, F &&f={}) {
 
 /******************************************************************************************/
 
-/// Return the equivalent vector but rotated so that it is lexicographically lowest
-/// Could be done without this concatenation strategy in the future
+/// Return the first index at which the rotation of v is lexicographically lowest
+/// Uses the two-candidate minimum rotation scan: O(n) element comparisons, with ties
+/// between equal rotations resolved to the smallest index
 template <class V>
 std::size_t lowest_rotational_order(V const &v) {
-    if (len(v) <= 1) return 0;
-    V v2{v};
-    auto n = len(v2);
-    cat(v2, v);
-    auto const b = begin_of(v2);
-    std::size_t best = 0;
-    for (std::size_t i = 1u; i != n; ++i)
-        if (std::lexicographical_compare(b + i, b + i + n, b + best, b + best + n))
-            best = i;
-    return best;
+    std::size_t const n = len(v);
+    if (n <= 1) return 0;
+    auto const b = begin_of(v);
+    auto const at = [&](std::size_t i) -> decltype(auto) {return *(b + (i < n ? i : i - n));};
+    std::size_t i = 0, j = 1, k = 0;
+    while (i < n && j < n && k < n) {
+        auto const &x = at(i + k), &y = at(j + k);
+        if (x < y) j += k + 1;
+        else if (y < x) i += k + 1;
+        else {++k; continue;}
+        if (i == j) ++j;
+        k = 0;
+    }
+    return std::min(i, j);
 }
 
 /******************************************************************************************/
@@ -9,6 +9,7 @@
 #include "../standard/Optional.h"
 #include "../standard/Map.h"
 #include "../types/Complex.h"
+#include "../reflect/Fingerprint.h"
 
 namespace nupack {
 
@@ -27,7 +28,7 @@ struct ModelConditions {
 /******************************************************************************************/
 
 template <class T>
-struct Model : MemberOrdered {
+struct Model : TotallyOrdered {
     using value_type = T;
     Model() = default;
     explicit Model(Ensemble, ParameterFile const &p={}, ModelConditions const &cs={}, Optional<WobblePairing> gu={});
@@ -43,9 +44,45 @@ struct Model : MemberOrdered {
     Ensemble ensemble;
     Pairable pairable;
     bool has_terminal_penalty = false;
+    Fingerprint digest; //< not reflected: derived from the members above
 
     bool valid() const {return bool(parameters.data.array);}
 
+    /**
+     * @brief Stable 128-bit digest of everything the energies depend on: the parameter values
+     * (which already include temperature, salt and loop bias), conditions, beta, ensemble,
+     * pairing rules and value type. It is computed on construction and on loading; call
+     * update_fingerprint() after modifying members directly.
+     */
+    Fingerprint fingerprint() const {return digest ? digest : compute_fingerprint();}
+    Fingerprint compute_fingerprint() const;
+    void update_fingerprint() {digest = compute_fingerprint();}
+
+    /// Models compare and hash by fingerprint instead of by their thousands of parameters
+    bool operator==(Model const &o) const {return fingerprint() == o.fingerprint();}
+    bool operator<(Model const &o) const {return fingerprint() < o.fingerprint();}
+    std::size_t hash() const {return fingerprint().hash();}
+
+    /// Serialized as the reflected members; loading recomputes the digest once
+    static constexpr auto repr_names() {
+        return make_names("parameters", "beta", "conditions", "possible_pairs", "has_terminal_penalty", "pairable", "ensemble");
+    }
+    auto save_repr() const {return make_members(parameters, beta, conditions, possible_pairs, has_terminal_penalty, pairable, ensemble);}
+    void load_repr(ParameterSet<T> p, T b, ModelConditions c, decltype(possible_pairs) pp, bool h, Pairable pa, Ensemble e) {
+        parameters = std::move(p); beta = b; conditions = c; possible_pairs = std::move(pp);
+        has_terminal_penalty = h; pairable = pa; ensemble = e;
+        update_fingerprint();
+    }
+
+    /// Copy in a different ensemble, with the ensemble-dependent pairing rules updated
+    Model with_ensemble(Ensemble e) const {
+        Model out = *this;
+        out.ensemble = e;
+        out.pairable.wobble_closing = pairable.wobble_pairing && (e == Ensemble::nostacking || e == Ensemble::stacking);
+        out.update_fingerprint();
+        return out;
+    }
+
     template <class ...Is>
     decltype(auto) dG(Is ...is) const {NUPACK_DASSERT(valid(), "Empty model"); return parameters.data(is...);}
 
@@ -53,6 +90,7 @@ struct Model : MemberOrdered {
     Model(Model<U> const &o) {
         static_assert(!is_same<U, T>, "Should use normal copy constructor");
         members_of(*this) = members_of(o);
+        update_fingerprint();
     }
 
     auto boltz(T e) const {return boltzmann_factor(beta, e);};
@@ -108,7 +146,7 @@ NUPACK_DEFINE_TEMPLATE(is_model, Model, class);
 template <class T>
 Model<T>::Model(Ensemble e, ParameterFile const &p, ModelConditions const &cs, Optional<WobblePairing> gu)
     : conditions(cs), parameters({p, "dG", dna_salt_correction(cs.temperature,
-        cs.na_molarity, cs.mg_molarity), cs.temperature}), beta(1.0 / (Kb * cs.temperature)), ensemble(e) {
+        cs.na_molarity, cs.mg_molarity), cs.temperature}), beta(1.0 / (Kb * differentiation_variable<T>(cs.temperature))), ensemble(e) {
 
     // Use parameter wobble setting if not specified
     if (gu) pairable.wobble_pairing = (*gu == WobblePairing::on);
@@ -120,6 +158,21 @@ Model<T>::Model(Ensemble e, ParameterFile const &p, ModelConditions const &cs, O
         possible_pairs[i].emplace_back(j);
         has_terminal_penalty |= terminal_penalty(i, j) != 0;
     }
+    update_fingerprint();
+}
+
+/******************************************************************************************/
+
+template <class T>
+Fingerprint Model<T>::compute_fingerprint() const {
+    if (!valid()) return {};
+    FingerprintBuilder f;
+    f(static_cast<std::uint32_t>(sizeof(T)))(static_cast<std::uint32_t>(ensemble))(primal(beta));
+    f(conditions.temperature)(conditions.na_molarity)(conditions.mg_molarity);
+    f(pairable.wobble_pairing)(pairable.wobble_closing)(parameters.material);
+    if constexpr(std::is_trivially_copyable_v<T>) f.bytes(parameters.data.begin(), ParameterData<T>::size * sizeof(T));
+    else for (auto const &x : parameters.data) f(primal(x)); // e.g. a Dual with a gradient: hash the values
+    return f.finish();
 }
 
 /******************************************************************************************/
@@ -190,7 +243,7 @@ T Model<T>::interior_energy(S1 const &seq1, S2 const &seq2) const {
 
         if (sz == 1) {
             // add stacking term for single-base bulges. No terminal penalty here
-            return en + dG(stack, front(seq1), back(seq1), front(seq2), back(seq2)) - parameters.info.loop_bias;
+            return en + dG(stack, front(seq1), back(seq1), front(seq2), back(seq2)) - parameters.loop_bias();
         } else {
             // Terminal penalty applies otherwise
             if (has_terminal_penalty) en += terminal_penalty(front(seq1), back(seq2))
@@ -115,8 +115,7 @@ value_type_of<M> stacking_energy(NoStacking, M const &, V const &, int const) {r
 
 template <class M, class V>
 value_type_of<M> stacking_energy(Stacking, M const &model, V const &v, int const nick) {
-    auto pf = stacking_sum<real>(v, nick, model);
-    return inverse_boltzmann(model.beta, pf);
+    return -log_stacking_sum<stack_value_t<M>>(v, nick, model) / model.beta;
 }
 
 // A list of sequences. nick indicates which one the strand break is before
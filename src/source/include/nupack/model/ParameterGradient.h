@@ -0,0 +1,126 @@
+/**
+ * @brief Energies differentiated with respect to every entry of a ParameterData array
+ *
+ * @file ParameterGradient.h
+ */
+#pragma once
+#include "Model.h"
+#include "../algorithms/Dual.h"
+#include "../standard/Vec.h"
+#include "../reflect/Memory.h"
+#include <algorithm>
+
+namespace nupack {
+
+/******************************************************************************************/
+
+/**
+ * @brief Sparse vector of partial derivatives, as (index, coefficient) pairs sorted by index
+ * Loop energies only depend on a handful of parameters, so these stay short
+ */
+template <class T>
+struct SparseGradient {
+    using index_type = std::uint32_t;
+    static constexpr std::size_t inline_size = 8;
+    small_vec<std::pair<index_type, T>, inline_size> entries;
+
+    static SparseGradient unit(index_type i) {SparseGradient g; g.entries.emplace_back(i, 1); return g;}
+
+    SparseGradient & operator+=(SparseGradient const &o) {add_scaled(*this, o, 1); return *this;}
+    SparseGradient & operator-=(SparseGradient const &o) {add_scaled(*this, o, -1); return *this;}
+    friend SparseGradient operator+(SparseGradient a, SparseGradient const &b) {return a += b;}
+    friend SparseGradient operator-(SparseGradient a, SparseGradient const &b) {return a -= b;}
+    SparseGradient operator-() const {SparseGradient out = *this; return out *= -1;}
+
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    SparseGradient & operator*=(U u) {for (auto &e : entries) e.second *= u; return *this;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    SparseGradient & operator/=(U u) {return *this *= T(1) / u;}
+
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend SparseGradient operator*(SparseGradient a, U u) {return a *= u;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend SparseGradient operator*(U u, SparseGradient a) {return a *= u;}
+    template <class U, NUPACK_IF(is_arithmetic<U>)>
+    friend SparseGradient operator/(SparseGradient a, U u) {return a /= u;}
+
+    /**
+     * @brief a += s * b, merged in place
+     * If a already holds every index of b, the coefficients are just updated. Otherwise a is
+     * grown to the size of the union and filled from the back, so no scratch vector is made
+     * and a reallocates only when the union outgrows its capacity.
+     */
+    friend void add_scaled(SparseGradient &a, SparseGradient const &b, T s) {
+        auto &x = a.entries;
+        auto const &y = b.entries;
+        std::size_t n = x.size();
+        for (auto i = x.begin(), j = y.begin(); j != y.end(); ++j) {
+            while (i != x.end() && i->first < j->first) ++i;
+            if (i == x.end() || i->first != j->first) ++n;
+        }
+        if (n == x.size()) {
+            auto i = x.begin();
+            for (auto const &e : y) {
+                while (i->first != e.first) ++i;
+                i->second += s * e.second;
+            }
+            return;
+        }
+        std::ptrdiff_t i = x.size(), j = y.size(), k = n;
+        x.resize(n);
+        while (j) {
+            if (i && x[i-1].first > y[j-1].first) {--i; x[--k] = x[i];}
+            else if (i && x[i-1].first == y[j-1].first) {--i; --j; x[--k] = {x[i].first, x[i].second + s * y[j].second};}
+            else {--j; x[--k] = {y[j].first, s * y[j].second};}
+        }
+    }
+
+    /// Add s times the coefficients into a dense vector
+    template <class V>
+    void add_to(V &dense, T s=1) const {for (auto const &e : entries) dense[e.first] += s * e.second;}
+
+    friend bool all_finite(SparseGradient const &g) {
+        return std::all_of(g.entries.begin(), g.entries.end(), [](auto const &e) {return std::isfinite(e.second);});
+    }
+
+    friend std::ostream & operator<<(std::ostream &os, SparseGradient const &g) {
+        os << '{';
+        for (auto const &e : g.entries) os << (&e == g.entries.data() ? "" : ", ") << e.first << ": " << e.second;
+        return os << '}';
+    }
+};
+
+/// A value with its gradient with respect to the entries of a ParameterData array
+template <class T>
+using ParameterDual = Dual<T, SparseGradient<T>>;
+
+namespace memory {
+    template <class T>
+    struct impl<ParameterDual<T>, void> {
+        std::size_t operator()(ParameterDual<T> const &d) const {
+            auto const n = d.slope.entries.capacity();
+            return sizeof(d) + (n > SparseGradient<T>::inline_size ? n * sizeof(std::pair<typename SparseGradient<T>::index_type, T>) : 0);
+        }
+        void erase(ParameterDual<T> &d) const {d.slope = {};}
+    };
+}
+
+/******************************************************************************************/
+
+/**
+ * @brief Copy of a model whose parameter entries carry unit gradients
+ * Any energy computed with it, e.g. by structure_energy(), comes out with its derivatives with
+ * respect to each entry of ParameterData: for energies linear in the parameters, the counts of
+ * each loop feature. The entries already include the temperature, salt and loop bias corrections.
+ */
+template <class T>
+Model<ParameterDual<T>> gradient_model(Model<T> const &m) {
+    Model<ParameterDual<T>> out(m);
+    auto it = out.parameters.data.begin();
+    for (std::uint32_t i = 0; i != ParameterData<T>::size; ++i) it[i].slope = SparseGradient<T>::unit(i);
+    return out;
+}
+
+/******************************************************************************************/
+
+}
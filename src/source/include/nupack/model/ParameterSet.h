@@ -6,6 +6,7 @@
 #include "../types/Matrix.h"
 #include "../standard/Ptr.h"
 #include "../reflect/Serialize.h"
+#include "../algorithms/Dual.h"
 #include "ParameterStorage.h"
 
 
@@ -13,6 +14,8 @@ namespace nupack {
 
 /******************************************************************************************/
 
+struct ParameterTables;
+
 struct ParameterFile : MemberOrdered {
 
     string path;
@@ -23,10 +26,26 @@ struct ParameterFile : MemberOrdered {
         1) the specified path
         2) "NUPACKHOME" environment variable
         3) then the NUPACK parameters folder (set by CMake)
+    Names ending in ".bin" refer to precompiled binary files (see compile()), any other
+    name without a ".json" suffix gets one
     */
     ParameterFile(string name="rna");
 
+    /// Full path of the file found by the priority ranking above
+    string resolve() const;
+
+    /// Parse the file as JSON (a binary file is converted back to the same JSON layout)
     json open() const;
+
+    /// Tables of the file from the process-wide registry, which keeps the few most recently used files parsed.
+    /// A binary file next to a JSON file of the same name is used instead if it is not older.
+    std::shared_ptr<ParameterTables const> load() const;
+
+    /// Release the tables held by the registry; tables still used by a ParameterSet stay alive until it is destroyed
+    static void clear_registry();
+
+    /// Write the tables of the file to a binary file which can be memory-mapped by load()
+    void compile(string const &out) const;
 };
 
 NUPACK_DEFINE_TYPE(is_parameter_file, ParameterFile);
@@ -95,6 +114,26 @@ struct ParameterData : TotallyOrdered {
 
 /******************************************************************************************/
 
+/**
+ * @brief Contents of one parameter file at the default temperature
+ * Shared and immutable: every ParameterSet built from the same file refers to one instance,
+ * and the tables of a binary file point directly into its read-only memory map.
+ */
+struct ParameterTables {
+    string material;
+    bool default_wobble_pairing = false;
+    ParameterData<real> dG, dH;
+
+    /// Table for a kind of parameter, "dG" or "dH"
+    ParameterData<real> const & at(string_view kind) const {
+        if (kind == "dG") return dG;
+        if (kind == "dH") return dH;
+        NUPACK_ERROR("invalid parameter kind", kind);
+    }
+};
+
+/******************************************************************************************/
+
 struct ParameterInfo {
     ParameterFile file;
     string kind = "dG";
@@ -114,11 +153,13 @@ struct ParameterSet : TotallyOrdered {
     ParameterData<T> data;
     std::string material;
     bool default_wobble_pairing;
+    /// Tables the set was built from; data is a copy of them adjusted for temperature, water and loop bias
+    std::shared_ptr<ParameterTables const> tables;
     NUPACK_REFLECT(ParameterSet, info, data, material, default_wobble_pairing);
 
     template <class U>
     ParameterSet(ParameterSet<U> const &o)
-        : info{o.info}, data(o.data), material(o.material), default_wobble_pairing(o.default_wobble_pairing) {
+        : info{o.info}, data(o.data), material(o.material), default_wobble_pairing(o.default_wobble_pairing), tables(o.tables) {
         static_assert(!is_same<T, U>, "Should use normal copy constructor");
     }
 
@@ -126,6 +167,9 @@ struct ParameterSet : TotallyOrdered {
 
     explicit ParameterSet(ParameterInfo i);
 
+    /// Loop bias, which is proportional to the temperature (see dna_salt_correction())
+    T loop_bias() const {return info.loop_bias * (differentiation_variable<T>(info.temperature) / info.temperature);}
+
     bool operator==(ParameterSet const &p) const {return info == p.info;}
     bool operator<(ParameterSet const &p) const {return info < p.info;}
 
@@ -139,23 +183,31 @@ struct ParameterSet : TotallyOrdered {
 
 /******************************************************************************************/
 
+/// water_molarity() of a Dual temperature
+template <class T>
+Dual<T> water_molarity(Dual<T> const &t) {return {water_molarity(t.value), water_molarity_slope(t.value) * t.slope};}
+
 template <class T>
 ParameterSet<T>::ParameterSet(ParameterInfo i) : info{std::move(i)} {
-    json const j = info.file.open();
-    data = ParameterData<T>(j.at("dG"));
-    j.at("default_wobble_pairing").get_to(default_wobble_pairing);
-    j.at("material").get_to(material);
+    tables = info.file.load();
+    default_wobble_pairing = tables->default_wobble_pairing;
+    material = tables->material;
+
+    // always a fresh array: the shared tables must not be modified
+    data = ParameterData<T>(ParameterData<T>::allocate());
+    std::copy(tables->dG.begin(), tables->dG.end(), data.begin());
 
-    T const t = info.temperature;
-    if (t != DefaultTemperature) {
+    // a Dual value type carries d/dT through every temperature-dependent term
+    T const t = differentiation_variable<T>(info.temperature);
+    if (traits::is_dual<T> || info.temperature != DefaultTemperature) {
         T kg = t / DefaultTemperature, kh = 1 - kg;
-        zip(data, ParameterData<T>(j.at("dH")), [kg, kh](T &g, T const &h) {
-            g = kg * g + kh * h;
+        zip(data, tables->dH, [kg, kh](T &g, real const &h) {
+            g = kg * g + kh * static_cast<T>(h);
         });
     }
 
-    data.begin()[decltype(join_penalty)::begin] -= std::log(water_molarity(t)) * Kb * t;
-    data.add_loop_bias(info.loop_bias);
+    data.begin()[decltype(join_penalty)::begin] -= dual_log(water_molarity(t)) * Kb * t;
+    data.add_loop_bias(loop_bias());
 }
 
 /******************************************************************************************/
@@ -6,8 +6,9 @@
 // The way it works is to consider all possibilities for a given base pair, then recursively
 // consider the next base pair's possibilities, etc. There is a bit of wrap-around logic for
 // the first base pair listed.
-// There could be some optimization to cut the sub-ensembles which are separated by more than
-// one base, or some mini-dynamic program could also be done presumably too.
+// This is exponential in the number of branches, so it is only used to list individual states
+// (see loop_stacking_energies()); loop free energies come from the linear-time transfer
+// matrix product in StackProgram.h.
 
 namespace nupack {
 
@@ -2,6 +2,7 @@
 #include "../types/Sequence.h"
 #include "../types/Matrix.h"
 #include "ParameterStorage.h"
+#include "../algorithms/Dual.h"
 
 // Loop free energy calculation using a dynamic program-ish method
 // Linear time, constant space in the number of base pairs in the loop
@@ -48,6 +49,18 @@ struct StackMatrix {
     }
 
     constexpr T trace() const {return Plus()(m[0][0], m[1][1]);}
+
+    /// Largest entry magnitude
+    real magnitude() const {
+        real s = 0;
+        for (auto const &r : m) for (auto const &x : r) s = max(s, std::abs(real(primal(x))));
+        return s;
+    }
+
+    StackMatrix & operator/=(real s) {
+        for (auto &r : m) for (auto &x : r) x = x / s;
+        return *this;
+    }
 };
 
 /******************************************************************************************/
@@ -83,19 +96,24 @@ Out factor(std::size_t l, std::size_t r, bool disable, E const &e) {
 
 /******************************************************************************************/
 
+/// Type of the stacking sums: real, or the model's Dual type so that derivatives are carried through
+template <class M>
+using stack_value_t = if_t<traits::is_dual<value_type_of<M>>, value_type_of<M>, real>;
+
 template <class M>
 struct StackModel {
+    using T = stack_value_t<M>;
     M const &model;
     Base ip, id, i, j, jd; // base paired to front of first, penultimate of first, last of first, first base of second, second base of second
 
-    real boltz(real e) const  {return model.boltz(e);}
-    real stack()       const  {return ip == Base('_') ? zero() : boltz(model.coaxial_stack_energy(ip, id, i, j));}
-    real left()        const  {return boltz(model.dG(dangle3, id, i, j));}
-    real right()       const  {return boltz(model.dG(dangle5, i, j, jd));}
-    real both()        const  {return boltz(model.terminal_mismatch(id, i, j, jd));}
+    T boltz(value_type_of<M> e) const {return model.boltz(e);}
+    T stack()       const  {return ip == Base('_') ? zero() : boltz(model.coaxial_stack_energy(ip, id, i, j));}
+    T left()        const  {return boltz(model.dG(dangle3, id, i, j));}
+    T right()       const  {return boltz(model.dG(dangle5, i, j, jd));}
+    T both()        const  {return boltz(model.terminal_mismatch(id, i, j, jd));}
 
-    real one() const {return 1;}
-    real zero() const {return 0;}
+    T one() const {return 1;}
+    T zero() const {return 0;}
 };
 
 template <class V, class M>
@@ -115,6 +133,24 @@ T stacking_sum(V const &v, int const nick, M const &model) {
     return q.trace();
 }
 
+/**
+ * @brief Logarithm of stacking_sum(), for loops with arbitrarily many branches
+ * The running product is rescaled whenever it drifts far from 1, so a loop whose factors
+ * multiply past the floating point range still gives a finite result.
+ */
+template <class T, class V, class M>
+T log_stacking_sum(V const &v, int const nick, M const &model) {
+    using A = StackMatrix<T, std::plus<T>, std::multiplies<T>>;
+    real log_scale = 0;
+    A q = factor<A>(len(back(v)), len(front(v)), nick == 0, stack_model(v, 0, model));
+    for (auto s : lrange(1, len(v))) {
+        q = q * factor<A>(len(v[s-1]), len(v[s]), nick == s, stack_model(v, s, model));
+        real const m = q.magnitude();
+        if (m > 1e100 || (m < 1e-100 && m > 0)) {q /= m; log_scale += std::log(m);}
+    }
+    return dual_log(q.trace()) + log_scale;
+}
+
 /******************************************************************************************/
 
 }
@@ -0,0 +1,171 @@
+/** \file Binary.h
+ * @brief Compact binary encoding of reflected classes and standard containers
+ * The encoding is native-endian and is meant for local caches, not for interchange.
+ */
+#pragma once
+#include "Reflection.h"
+#include "../algorithms/Traits.h"
+#include "../common/Error.h"
+
+#include <boost/container/small_vector.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+#include <array>
+#include <cstring>
+
+namespace nupack::binary {
+
+/******************************************************************************************/
+
+/// Input which is truncated or otherwise does not fit the type being decoded
+struct FormatError : Error {
+    using Error::Error;
+};
+
+/// Cursor over a contiguous input buffer, throws FormatError if read past the end
+struct Reader {
+    char const *begin, *end;
+
+    std::size_t remaining() const {return std::size_t(end - begin);}
+
+    void read(void *out, std::size_t n) {
+        if (remaining() < n) throw FormatError("binary input is truncated: ", n, " bytes needed, ", remaining(), " left");
+        std::memcpy(out, begin, n);
+        begin += n;
+    }
+
+    template <class T> T get() {T t; read(&t, sizeof(T)); return t;}
+};
+
+inline void write_bytes(std::string &out, void const *p, std::size_t n) {out.append(static_cast<char const *>(p), n);}
+
+/******************************************************************************************/
+
+/// Binary implementation, specialize this for classes not covered below
+template <class T, class=void> struct impl;
+
+template <class T> void save(std::string &out, T const &t) {impl<T>::save(out, t);}
+template <class T> void load(Reader &in, T &t) {impl<T>::load(in, t);}
+
+/// Fewest bytes that any encoding of T takes, used to reject element counts before allocating
+template <class T> static constexpr std::size_t min_bytes = impl<T>::min_bytes;
+
+/******************************************************************************************/
+
+/// Scalars and enums are copied bytewise
+template <class T> struct impl<T, void_if<std::is_scalar_v<T> && !std::is_pointer_v<T>>> {
+    static constexpr std::size_t min_bytes = sizeof(T);
+    static void save(std::string &out, T const &t) {write_bytes(out, &t, sizeof(T));}
+    static void load(Reader &in, T &t) {in.read(&t, sizeof(T));}
+};
+
+/******************************************************************************************/
+
+/// Contiguous containers of scalars are copied in one go, otherwise elementwise
+template <class V> struct contiguous_impl {
+    using value_type = typename V::value_type;
+    static constexpr std::size_t min_bytes = sizeof(std::uint64_t);
+
+    static void save(std::string &out, V const &v) {
+        binary::save(out, std::uint64_t(v.size()));
+        if constexpr(std::is_scalar_v<value_type>) write_bytes(out, v.data(), v.size() * sizeof(value_type));
+        else for (auto const &x : v) binary::save(out, x);
+    }
+
+    static void load(Reader &in, V &v) {
+        auto const n = in.get<std::uint64_t>();
+        // the count comes from the input, so check that it fits before allocating
+        constexpr std::size_t each = binary::min_bytes<value_type>;
+        if (each && n > in.remaining() / each)
+            throw FormatError("binary input is truncated: ", n, " elements do not fit in ", in.remaining(), " bytes");
+        v.resize(n);
+        if constexpr(std::is_scalar_v<value_type>) in.read(v.data(), v.size() * sizeof(value_type));
+        else for (auto &x : v) binary::load(in, x);
+    }
+};
+
+template <class T, class A> struct impl<std::vector<T, A>> : contiguous_impl<std::vector<T, A>> {
+    static_assert(!std::is_same_v<T, bool>, "std::vector<bool> is not supported");
+};
+
+template <class T, std::size_t N, class ...Ts>
+struct impl<boost::container::small_vector<T, N, Ts...>> : contiguous_impl<boost::container::small_vector<T, N, Ts...>> {};
+
+template <class C, class Tr, class A>
+struct impl<std::basic_string<C, Tr, A>> : contiguous_impl<std::basic_string<C, Tr, A>> {};
+
+/******************************************************************************************/
+
+template <class T, std::size_t N> struct impl<std::array<T, N>> {
+    static constexpr std::size_t min_bytes = N * binary::min_bytes<T>;
+    static void save(std::string &out, std::array<T, N> const &a) {for (auto const &x : a) binary::save(out, x);}
+    static void load(Reader &in, std::array<T, N> &a) {for (auto &x : a) binary::load(in, x);}
+};
+
+/******************************************************************************************/
+
+template <class T> struct impl<std::optional<T>> {
+    static constexpr std::size_t min_bytes = sizeof(bool);
+    static void save(std::string &out, std::optional<T> const &t) {
+        binary::save(out, bool(t));
+        if (t) binary::save(out, *t);
+    }
+    static void load(Reader &in, std::optional<T> &t) {
+        if (in.get<bool>()) binary::load(in, t.emplace());
+        else t.reset();
+    }
+};
+
+/******************************************************************************************/
+
+template <class T, class U> struct impl<std::pair<T, U>> {
+    static constexpr std::size_t min_bytes = binary::min_bytes<T> + binary::min_bytes<U>;
+    static void save(std::string &out, std::pair<T, U> const &t) {binary::save(out, t.first); binary::save(out, t.second);}
+    static void load(Reader &in, std::pair<T, U> &t) {binary::load(in, t.first); binary::load(in, t.second);}
+};
+
+template <class ...Ts> struct impl<std::tuple<Ts...>> {
+    static constexpr std::size_t min_bytes = (std::size_t(0) + ... + binary::min_bytes<Ts>);
+    static void save(std::string &out, std::tuple<Ts...> const &t) {
+        std::apply([&](auto const &...ts) {(binary::save(out, ts), ...);}, t);
+    }
+    static void load(Reader &in, std::tuple<Ts...> &t) {
+        std::apply([&](auto &...ts) {(binary::load(in, ts), ...);}, t);
+    }
+};
+
+/******************************************************************************************/
+
+/// Class with declared members API
+template <class T> struct impl<T, void_if<has_members<T>>> {
+    template <class ...Ts>
+    static constexpr std::size_t sum(std::tuple<Ts...> const *) {return (std::size_t(0) + ... + binary::min_bytes<std::decay_t<Ts>>);}
+    static constexpr std::size_t min_bytes = sum(static_cast<decltype(members_of(std::declval<T &>())) const *>(nullptr));
+    static void save(std::string &out, T const &t) {
+        std::apply([&](auto const &...ts) {(binary::save(out, ts), ...);}, members_of(t));
+    }
+    static void load(Reader &in, T &t) {
+        std::apply([&](auto &...ts) {(binary::load(in, ts), ...);}, members_of(t));
+    }
+};
+
+/******************************************************************************************/
+
+/// Encode an object into a string of bytes
+template <class T>
+std::string dumps(T const &t) {std::string out; save(out, t); return out;}
+
+/// Decode an object from a range of bytes, which must be consumed exactly
+template <class T>
+T loads(char const *b, char const *e) {
+    Reader in{b, e};
+    T t;
+    load(in, t);
+    if (in.begin != in.end) throw FormatError("binary input has ", in.remaining(), " trailing bytes");
+    return t;
+}
+
+/******************************************************************************************/
+
+}
@@ -0,0 +1,127 @@
+/**
+ * @brief Stable 128-bit digests for identifying objects across processes
+ *
+ * @file Fingerprint.h
+ */
+#pragma once
+#include "Print.h"
+#include "../algorithms/Operators.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace nupack {
+
+/******************************************************************************************/
+
+/// 128-bit digest which, unlike std::hash, is the same in every process and run on a given platform
+struct Fingerprint : TotallyOrdered {
+    std::uint64_t high = 0, low = 0;
+    NUPACK_REFLECT(Fingerprint, high, low);
+
+    /// Whether this is a computed fingerprint rather than the default (zero) value
+    explicit operator bool() const {return high || low;}
+
+    bool operator==(Fingerprint const &o) const {return high == o.high && low == o.low;}
+    bool operator<(Fingerprint const &o) const {return high < o.high || (high == o.high && low < o.low);}
+
+    /// The bits are already uniformly mixed, so any 64 of them make a good hash
+    std::size_t hash() const {return static_cast<std::size_t>(low);}
+
+    /// 32 hexadecimal digits
+    std::string hex() const {
+        char s[33];
+        std::snprintf(s, sizeof(s), "%016llx%016llx", static_cast<unsigned long long>(high), static_cast<unsigned long long>(low));
+        return s;
+    }
+};
+
+/******************************************************************************************/
+
+/**
+ * @brief Incremental 128-bit hash of a byte stream (MurmurHash3 x64_128)
+ * Values are hashed by their object representation, so fingerprints agree between processes
+ * on platforms of the same byte order, but not necessarily between such platforms.
+ */
+class FingerprintBuilder {
+    static constexpr std::uint64_t c1 = 0x87c37b91114253d5ull, c2 = 0x4cf5ad432745937full;
+
+    std::uint64_t h1, h2, length = 0;
+    std::array<unsigned char, 16> tail;
+    std::size_t n_tail = 0;
+
+    static constexpr std::uint64_t rotl(std::uint64_t x, int r) {return (x << r) | (x >> (64 - r));}
+
+    static constexpr std::uint64_t fmix(std::uint64_t k) {
+        k ^= k >> 33; k *= 0xff51afd7ed558ccdull;
+        k ^= k >> 33; k *= 0xc4ceb9fe1a85ec53ull;
+        return k ^ (k >> 33);
+    }
+
+    void mix1(std::uint64_t k1) {k1 *= c1; k1 = rotl(k1, 31); k1 *= c2; h1 ^= k1;}
+    void mix2(std::uint64_t k2) {k2 *= c2; k2 = rotl(k2, 33); k2 *= c1; h2 ^= k2;}
+
+    void block(unsigned char const *p) {
+        std::uint64_t k1, k2;
+        std::memcpy(&k1, p, 8);
+        std::memcpy(&k2, p + 8, 8);
+        mix1(k1); h1 = rotl(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+        mix2(k2); h2 = rotl(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+    }
+
+public:
+    explicit FingerprintBuilder(std::uint64_t seed=0) : h1(seed), h2(seed) {}
+
+    /// Append raw bytes
+    FingerprintBuilder & bytes(void const *data, std::size_t n) {
+        auto p = static_cast<unsigned char const *>(data);
+        length += n;
+        if (n_tail) {
+            auto const m = std::min(n, 16 - n_tail);
+            std::memcpy(tail.data() + n_tail, p, m);
+            n_tail += m; p += m; n -= m;
+            if (n_tail < 16) return *this;
+            block(tail.data());
+            n_tail = 0;
+        }
+        for (; n >= 16; p += 16, n -= 16) block(p);
+        std::memcpy(tail.data(), p, n);
+        n_tail = n;
+        return *this;
+    }
+
+    /// Append a trivially copyable value
+    template <class T, NUPACK_IF(std::is_trivially_copyable_v<T>)>
+    FingerprintBuilder & operator()(T const &t) {return bytes(&t, sizeof(T));}
+
+    /// Append a string, prefixed by its length so that consecutive strings cannot run together
+    FingerprintBuilder & operator()(std::string_view s) {
+        (*this)(static_cast<std::uint64_t>(s.size()));
+        return bytes(s.data(), s.size());
+    }
+    FingerprintBuilder & operator()(char const *s) {return (*this)(std::string_view(s));}
+
+    Fingerprint finish() const {
+        std::uint64_t a = h1, b = h2, k1 = 0, k2 = 0;
+        for (std::size_t i = n_tail; i-- > 8;) k2 = (k2 << 8) | tail[i];
+        for (std::size_t i = std::min<std::size_t>(n_tail, 8); i-- > 0;) k1 = (k1 << 8) | tail[i];
+        if (n_tail > 8) {k2 *= c2; k2 = rotl(k2, 33); k2 *= c1; b ^= k2;}
+        if (n_tail > 0) {k1 *= c1; k1 = rotl(k1, 31); k1 *= c2; a ^= k1;}
+        a ^= length; b ^= length;
+        a += b; b += a;
+        a = fmix(a); b = fmix(b);
+        a += b; b += a;
+        Fingerprint out;
+        out.high = b;
+        out.low = a;
+        return out;
+    }
+};
+
+/******************************************************************************************/
+
+}
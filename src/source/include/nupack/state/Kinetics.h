@@ -0,0 +1,495 @@
+/**
+ * @brief Gillespie simulation of secondary structure kinetics with elementary base pair steps
+ *
+ * @file Kinetics.h
+ */
+#pragma once
+#include "State.h"
+#include "../reflect/Hash.h"
+#include <unordered_map>
+
+namespace nupack {
+
+/******************************************************************************************/
+
+/// Prefactors of the elementary steps
+struct KineticRates {
+    /// Unimolecular prefactor (1/s) of base pair formation and breakage (Kawasaki rule)
+    real unimolecular = 6.1e7;
+    /// Bimolecular prefactor (1/M/s) of association of two complexes
+    real bimolecular = 1.26e6;
+    /// Strand concentration (M), which sets the association rate
+    real molarity = 1e-6;
+    NUPACK_REFLECT(KineticRates, unimolecular, bimolecular, molarity);
+};
+
+/// A macrostate: reached when the pair list is within a Hamming distance of a target structure
+struct StopCondition {
+    PairList target;
+    usize distance = 0;
+    NUPACK_REFLECT(StopCondition, target, distance);
+};
+
+/// End of one trajectory
+struct FirstPassage {
+    /// Simulated time (s)
+    real time = 0;
+    usize steps = 0;
+    /// Index of the condition which stopped the trajectory, or -1 if it ran out of time or moves
+    int condition = -1;
+    /// Final structure and free energy
+    PairList pairs;
+    real energy = 0;
+    NUPACK_REFLECT(FirstPassage, time, steps, condition, pairs, energy);
+};
+
+/******************************************************************************************/
+
+/// Index of the nearest entry accepted by f, in case floating point error lands on an empty one
+template <class F>
+usize nearest_nonzero(usize o, usize n, F const &f) {
+    for (auto i = o; i < n; ++i) if (f(i)) return i;
+    while (o--) if (f(o)) return o;
+    NUPACK_ERROR("no move has a nonzero rate");
+}
+
+/******************************************************************************************/
+
+/**
+ * @brief Continuous time Markov chain over the secondary structures of a fixed set of strands
+ * Moves are the formation or breakage of one base pair, including association and dissociation
+ * of complexes. Formation and breakage within a complex follow the Kawasaki rule
+ * k exp(-beta dG / 2); association has rate k_bi c per pair of bases and dissociation the
+ * matching detailed balance rate.
+ * A step within a complex splits one loop in two or merges a loop into its parent in place, so
+ * only those loops have their moves and loop energies evaluated, and only they and their
+ * children change their entries in the add_rates and del_rates Fenwick trees of JumpStateBase,
+ * which are indexed by loop. Moves are then chosen in O(log n). Association and dissociation
+ * change the complexes, so they rebuild the loop decomposition, which is linear time, and look
+ * up the loops they did not change by their sequences.
+ */
+template <class Model>
+struct Kinetics {
+    using state_type = StaticState<JumpStateBase>;
+    using Loop = typename state_type::Loop;
+    using Key = vec<iseq>;
+
+    struct AddMove {iseq i, j;};
+
+    /// Moves and energy of one loop, which only depend on its own sequences
+    struct LoopData {
+        real energy;
+        vec<AddMove> adds;
+        /// Cumulative rates of adds
+        vec<long double> cumulative;
+        /// Unpaired bases of each canonical type, filled for exterior loops only
+        std::array<vec<iseq>, 4> free;
+    };
+
+    /// Breakage of the pair between a loop and its parent, which depends on both
+    struct DeleteData {iseq i, j; long double rate;};
+
+    state_type state;
+    Model const *model;
+    KineticRates rates;
+    real time = 0;
+    usize steps = 0;
+
+    Kinetics(state_type s, Model const &m, KineticRates r) : state(std::move(s)), model(&m), rates(r) {update({});}
+
+    /// Take one step unless there are no moves or the next one happens after time "until"
+    template <class RNG>
+    bool step(RNG &rng, real until=*inf);
+
+    /// Total rate of leaving the current state
+    long double total_rate() const {return state.add_rates.total() + state.del_rates.total() + join_total;}
+
+private:
+    /// Data of the loops before a rebuild, keyed by their sequences
+    struct Cache {
+        std::unordered_map<Key, std::shared_ptr<LoopData const>, RangeHash<Key>> loops;
+        std::unordered_map<Key, DeleteData, RangeHash<Key>> deletes;
+    };
+
+    vec<std::shared_ptr<LoopData const>> loop_data;
+    vec<DeleteData> delete_data;
+    /// (loop, loop, total association rate) for each pair of exterior loops in different complexes
+    vec<std::tuple<usize, usize, long double>> join_pairs;
+    long double join_total = 0;
+
+    Key loop_key(usize o) const {
+        Key k;
+        for (auto const &s : state.loops[o].sequences()) {
+            k.push_back(state.sys->index(s.begin()));
+            k.push_back(state.sys->index(s.end()));
+        }
+        return k;
+    }
+
+    Key delete_key(usize o) const {
+        auto k = loop_key(o);
+        k.push_back(iseq(-1));
+        extend(k, loop_key(state.loops[o].parent()));
+        return k;
+    }
+
+    real energy(SubsequenceList v) const {
+        SequenceSet s(std::move(v));
+        return model->loop_energy(s.vec(), s.nick());
+    }
+
+    long double kawasaki(real dE) const {return rates.unimolecular * std::exp(-0.5 * model->beta * dE);}
+
+    iseq complex_of(usize o) const {return state.complexes.strand_map[state.loops[o].strand_index(state)].x;}
+
+    std::shared_ptr<LoopData const> make_loop(usize o) const;
+    DeleteData make_delete(usize o) const;
+    long double join_rate(usize a, usize b) const;
+
+    void set_loop(usize o);
+    void set_delete(usize o);
+    void erase_joins(usize o);
+    void set_joins(usize o);
+    void refresh(std::initializer_list<usize> changed);
+
+    Cache cache() const;
+    void update(Cache const &);
+    void toggle(iseq i, iseq j);
+    void split(usize o, iseq i, iseq j);
+    void merge(usize k);
+    void apply(iseq i, iseq j);
+};
+
+/******************************************************************************************/
+
+template <class Model>
+auto Kinetics<Model>::make_loop(usize o) const -> std::shared_ptr<LoopData const> {
+    auto const &loop = state.loops[o];
+    auto const &v = loop.sequences();
+    auto const &sys = *state.sys;
+    auto out = std::make_shared<LoopData>();
+    out->energy = model->loop_energy(v, loop.nick());
+
+    for (auto s1 : indices(v)) for (auto b1 = v[s1].begin() + 1; b1 < v[s1].end() - 1; ++b1) {
+        if (*b1 == Base('_')) continue;
+        if (loop.exterior() && BaseIndex(*b1) < 4) out->free[BaseIndex(*b1)].push_back(sys.index(b1));
+        for (auto s2 : range(s1, len(v))) {
+            for (auto b2 = (s2 == s1 ? b1 + 1 : v[s2].begin() + 1); b2 < v[s2].end() - 1; ++b2) {
+                if (*b2 == Base('_')) continue;
+                bool const diff = sys.strand_of(b1) != sys.strand_of(b2);
+                if (!model->pairable(diff, std::min(b1, b2), std::max(b1, b2))) continue;
+                auto const split = split_midway(v, begin_of(v) + s1, begin_of(v) + s2, b1, b2);
+                real const dE = energy(split.first) + energy(split.second) - out->energy;
+                out->adds.push_back({iseq(sys.index(b1)), iseq(sys.index(b2))});
+                out->cumulative.push_back((out->cumulative.empty() ? 0 : out->cumulative.back()) + kawasaki(dE));
+            }
+        }
+    }
+    return out;
+}
+
+/******************************************************************************************/
+
+template <class Model>
+auto Kinetics<Model>::make_delete(usize o) const -> DeleteData {
+    auto const &k = state.loops[o];
+    auto const &p = state.loops[k.parent()];
+    iseq const pk = k.edges.parent_loc, kp = p.edges.find_edge_index(k.index());
+    auto const bp = k.parent_base_pair();
+    DeleteData out{iseq(state.sys->index(bp.first)), iseq(state.sys->index(bp.second)), 0};
+    real const before = model->loop_energy(k.sequences(), k.nick()) + model->loop_energy(p.sequences(), p.nick());
+
+    if (k.exterior() && p.exterior()) {
+        // both loops hold a nick, so the complex falls apart
+        auto const split = get_split_seqs(p.sequences(), k.sequences(), p.nick(), k.nick(), pk, kp);
+        real const dE = energy(split.first) + energy(split.second) - before - model->join_penalty();
+        out.rate = rates.bimolecular * water_molarity(model->conditions.temperature) * std::exp(-model->beta * dE);
+    } else {
+        out.rate = kawasaki(energy(merged_seqs(p.sequences(), k.sequences(), pk, kp)) - before);
+    }
+    return out;
+}
+
+/******************************************************************************************/
+
+/// Association rate between exterior loops a and b, k_bi c per pair of bases
+template <class Model>
+long double Kinetics<Model>::join_rate(usize a, usize b) const {
+    long double count = 0;
+    for (auto x : range(4)) for (auto y : range(4)) if (model->pairable.can_pair(Base(true, x), Base(true, y)))
+        count += len(loop_data[a]->free[x]) * len(loop_data[b]->free[y]);
+    return count * rates.bimolecular * rates.molarity;
+}
+
+/******************************************************************************************/
+
+/// Evaluate the moves of loop o and update its addition rate and the state energy
+template <class Model>
+void Kinetics<Model>::set_loop(usize o) {
+    auto data = make_loop(o);
+    state.energy += data->energy - (loop_data[o] ? loop_data[o]->energy : 0);
+    state.add_rates.update(o, data->cumulative.empty() ? 0 : data->cumulative.back());
+    loop_data[o] = std::move(data);
+}
+
+/// Evaluate the breakage of the pair between loop o and its parent
+template <class Model>
+void Kinetics<Model>::set_delete(usize o) {
+    delete_data[o] = state.loops[o].is_root() ? DeleteData{0, 0, 0} : make_delete(o);
+    state.del_rates.update(o, delete_data[o].rate);
+}
+
+/******************************************************************************************/
+
+template <class Model>
+void Kinetics<Model>::erase_joins(usize o) {
+    join_pairs.erase(std::remove_if(begin_of(join_pairs), end_of(join_pairs), [o](auto const &t) {
+        return std::get<0>(t) == o || std::get<1>(t) == o;
+    }), end_of(join_pairs));
+}
+
+/// Replace the association moves of loop o, which need loop_data to be current for the exterior loops
+template <class Model>
+void Kinetics<Model>::set_joins(usize o) {
+    erase_joins(o);
+    if (state.loops[o].exterior()) {
+        auto const x = complex_of(o);
+        // each strand begins after the nick of one exterior loop
+        for (auto const &s : state.complexes.strand_map) if (s.x != x) {
+            auto const r = join_rate(o, s.loop);
+            if (r) join_pairs.emplace_back(o, s.loop, r);
+        }
+    }
+    join_total = sum(join_pairs, [](auto const &t) {return std::get<2>(t);});
+}
+
+/******************************************************************************************/
+
+/// Reevaluate loops whose sequences changed, along with the pairs to their children
+template <class Model>
+void Kinetics<Model>::refresh(std::initializer_list<usize> changed) {
+    for (auto o : changed) {
+        auto const &loop = state.loops[o];
+        if (loop.exterior()) state.complexes.set_loop_index(loop.strand_index(state), o);
+        set_loop(o);
+    }
+    for (auto o : changed) {
+        set_delete(o);
+        for (auto e : state.loops[o].edges) if (e != Ether && e != state.loops[o].parent()) set_delete(e);
+    }
+    for (auto o : changed) set_joins(o);
+}
+
+/******************************************************************************************/
+
+template <class Model>
+auto Kinetics<Model>::cache() const -> Cache {
+    Cache out;
+    for (auto o : indices(state.loops)) {
+        out.loops.emplace(loop_key(o), loop_data[o]);
+        if (!state.loops[o].is_root()) out.deletes.emplace(delete_key(o), delete_data[o]);
+    }
+    return out;
+}
+
+/// Evaluate all loops from scratch, except those found in the cache
+template <class Model>
+void Kinetics<Model>::update(Cache const &cache) {
+    auto const n = len(state.loops);
+    loop_data.resize(n);
+    delete_data.assign(n, DeleteData{0, 0, 0});
+
+    vec<long double> add(n), del(n, 0);
+    for (auto o : range(n)) {
+        auto it = cache.loops.find(loop_key(o));
+        loop_data[o] = it != cache.loops.end() ? it->second : make_loop(o);
+        add[o] = loop_data[o]->cumulative.empty() ? 0 : loop_data[o]->cumulative.back();
+    }
+    for (auto o : range(n)) {
+        if (state.loops[o].is_root()) continue;
+        auto it = cache.deletes.find(delete_key(o));
+        delete_data[o] = it != cache.deletes.end() ? it->second : make_delete(o);
+        del[o] = delete_data[o].rate;
+    }
+    state.add_rates.assign(add.begin(), add.end());
+    state.del_rates.assign(del.begin(), del.end());
+
+    join_pairs.clear();
+    auto const &strands = state.complexes.strand_map;
+    for_ordered_pairs(begin_of(strands), end_of(strands), [&](auto const &a, auto const &b) {
+        if (a->x == b->x) return;
+        auto const r = join_rate(a->loop, b->loop);
+        if (r) join_pairs.emplace_back(a->loop, b->loop, r);
+    });
+    join_total = sum(join_pairs, [](auto const &t) {return std::get<2>(t);});
+
+    state.energy = (len(state.sys->strands) - len(state.complexes)) * model->join_penalty()
+        + sum(loop_data, [](auto const &d) {return d->energy;});
+}
+
+/******************************************************************************************/
+
+template <class Model>
+void Kinetics<Model>::toggle(iseq i, iseq j) {
+    state.last_move = {Base_Pair(i, j), real(total_rate())};
+    state.pairs.toggle_pair(i, j);
+}
+
+/******************************************************************************************/
+
+/// Add the pair (i, j) between two unpaired bases of loop o, which becomes two loops
+template <class Model>
+void Kinetics<Model>::split(usize o, iseq i, iseq j) {
+    toggle(i, j);
+    auto &loops = state.loops;
+    auto locate = [&, &v=loops[o].sequences()](iseq b) {
+        auto const it = state.sys->iterator_at(b);
+        for (auto s : indices(v)) if (v[s].begin() < it && it < v[s].end() - 1) return std::make_pair(iseq(s), it);
+        NUPACK_BUG("base is not unpaired in the loop", b, o);
+    };
+    auto b1 = locate(i), b2 = locate(j);
+    if (b2 < b1) swap(b1, b2);
+
+    auto const n = len(loops);
+    loops.emplace_back();
+    auto &p = loops[o], &k = loops.back();
+    auto const shift = p.seqs.split(BasePairAddition(b1.second, b2.second, b1.first, b2.first, 0), k.seqs);
+    // the new loop takes the edges of the sequences strictly after b1 up to b2
+    k.edges = p.edges.split(Edge(n), b1.first + 1, b2.first + 1, Loop::edge_getter(loops));
+    p.edges.rotate(shift.first);
+    k.edges.rotate(shift.second);
+
+    loop_data.emplace_back();
+    delete_data.push_back({0, 0, 0});
+    state.add_rates.emplace_back(0);
+    state.del_rates.emplace_back(0);
+    refresh({o, n});
+}
+
+/******************************************************************************************/
+
+/// Break the pair between loop k and its parent, which absorbs k, within one complex
+template <class Model>
+void Kinetics<Model>::merge(usize k) {
+    auto &loops = state.loops;
+    auto const p = usize(loops[k].parent()), last = len(loops) - 1;
+    toggle(delete_data[k].i, delete_data[k].j);
+    loops[p] = merge_loops(loops[p], loops[k], loops);
+    erase_joins(k);
+    state.energy -= loop_data[k]->energy;
+
+    // the last loop takes the index of k
+    if (k != last) {
+        loops[last].edges.transfer(Edge(k), Loop::edge_getter(loops));
+        loops[k] = std::move(loops[last]);
+        loop_data[k] = std::move(loop_data[last]);
+        delete_data[k] = delete_data[last];
+        state.add_rates.update(k, state.add_rates[last]);
+        state.del_rates.update(k, state.del_rates[last]);
+        if (loops[k].exterior()) state.complexes.set_loop_index(loops[k].strand_index(state), k);
+        for (auto &t : join_pairs) for (auto *x : {&std::get<0>(t), &std::get<1>(t)}) if (*x == last) *x = k;
+    }
+    loops.pop_back();
+    loop_data.pop_back();
+    delete_data.pop_back();
+    state.add_rates.pop_back();
+    state.del_rates.pop_back();
+    refresh({p == last ? k : p});
+}
+
+/******************************************************************************************/
+
+/// Toggle the pair (i, j) and rebuild the loops, for moves which change the complexes
+template <class Model>
+void Kinetics<Model>::apply(iseq i, iseq j) {
+    auto const old = cache();
+    toggle(i, j);
+    state.loops.clear();
+    state.build();
+    update(old);
+}
+
+/******************************************************************************************/
+
+template <class Model> template <class RNG>
+bool Kinetics<Model>::step(RNG &rng, real until) {
+    long double const add = state.add_rates.total(), del = state.del_rates.total(), total = add + del + join_total;
+    if (!(total > 0)) {time = until; return false;}
+    std::uniform_real_distribution<long double> uniform(0, 1);
+    real const dt = -std::log(1 - uniform(rng)) / total;
+    if (time + dt > until) {time = until; return false;}
+    time += dt;
+    ++steps;
+
+    long double r = uniform(rng) * total;
+    if (r < add) {
+        auto [o, rem] = state.add_rates.find(r);
+        auto const o2 = nearest_nonzero(o, len(loop_data), [&](usize i) {return !loop_data[i]->adds.empty();});
+        if (o2 != o) rem = o2 > o ? 0 : loop_data[o2]->cumulative.back();
+        auto const &d = *loop_data[o2];
+        auto const m = d.adds[min(len(d.adds) - 1, usize(std::upper_bound(d.cumulative.begin(), d.cumulative.end(), rem) - d.cumulative.begin()))];
+        split(o2, m.i, m.j);
+    } else if ((r -= add) < del || join_pairs.empty()) {
+        auto const o = nearest_nonzero(state.del_rates.find(r).first, len(delete_data), [&](usize i) {return delete_data[i].rate > 0;});
+        auto const &k = state.loops[o];
+        if (k.exterior() && state.loops[k.parent()].exterior()) apply(delete_data[o].i, delete_data[o].j);
+        else merge(o);
+    } else {
+        r -= del;
+        auto it = begin_of(join_pairs);
+        for (; it + 1 != end_of(join_pairs) && r >= std::get<2>(*it); ++it) r -= std::get<2>(*it);
+        auto const &a = *loop_data[std::get<0>(*it)], &b = *loop_data[std::get<1>(*it)];
+        // choose the base types, then bases of those types uniformly
+        r /= rates.bimolecular * rates.molarity;
+        std::pair<iseq, iseq> pick;
+        for (auto x : range(4)) for (auto y : range(4)) if (model->pairable.can_pair(Base(true, x), Base(true, y))) {
+            auto const ny = len(b.free[y]);
+            long double const c = len(a.free[x]) * ny;
+            if (!c) continue;
+            // the last candidate is kept in case floating point error overruns the total
+            auto const k = usize(min(c - 1, std::floor(r)));
+            pick = {a.free[x][k / ny], b.free[y][k % ny]};
+            if (r < c) break;
+            r -= c;
+        }
+        apply(pick.first, pick.second);
+    }
+    return true;
+}
+
+/******************************************************************************************/
+
+/**
+ * @brief Run independent trajectories in parallel until each reaches one of the conditions
+ * Each trajectory has its own generator seeded from StaticRNG, so results are reproducible for
+ * a given StaticRNG state regardless of the number of threads.
+ * @param start initial strands and structure
+ * @param conditions stop conditions, whose targets are given over the same strands as start
+ * @param max_time simulated time (s) after which a trajectory stops regardless
+ * @param max_steps maximum number of steps per trajectory, or 0 for no limit
+ * @return first passage time and final state of each trajectory
+ */
+template <class E, class Model>
+vec<FirstPassage> first_passage_times(E &&env, StateBase const &start, Model const &model, vec<StopCondition> conditions,
+                                      usize n_trajectories, real max_time, KineticRates const &rates={}, usize max_steps=0) {
+    for (auto &c : conditions) c.target = StateBase(start.sys, std::move(c.target)).pairs;
+    auto const initial = Kinetics<Model>(StaticState<JumpStateBase>(start.sys, start.pairs), model, rates);
+    vec<std::uint_fast32_t> seeds(n_trajectories);
+    for (auto &s : seeds) s = StaticRNG();
+
+    return env.map(n_trajectories, 1, [&](auto const &, usize t) {
+        DefaultRNG rng(seeds[t]);
+        auto k = initial;
+        auto reached = [&] {
+            for (auto c : indices(conditions)) if ((k.state.pairs ^ conditions[c].target) <= conditions[c].distance) return int(c);
+            return -1;
+        };
+        int c = reached();
+        while (c < 0 && (!max_steps || k.steps < max_steps) && k.step(rng, max_time)) c = reached();
+        return FirstPassage{k.time, k.steps, c, k.state.pairs, k.state.energy};
+    });
+}
+
+/******************************************************************************************/
+
+}
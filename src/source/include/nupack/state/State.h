@@ -1,19 +1,65 @@
 #pragma once
 #include "StaticState.h"
 #include "../model/Model.h"
+#include "../reflect/Hash.h"
+#include <unordered_map>
 
 namespace nupack {
 
 /******************************************************************************************/
 
+namespace detail {
+    /// Energy of a built state, optionally including its rotational symmetry correction
+    template <class W, class Model>
+    auto state_energy(W const &w, Model const &em, bool distinguishable) {
+        w.check_structure(em.pairable);
+        auto out = w.calculate_energy(em);
+        if (!distinguishable) out += std::log(real(w.symmetry())) / em.beta;
+        return out;
+    }
+}
+
 template <class S, class Model>
 auto structure_energy(S &&sequences, PairList p, Model const &em, bool distinguishable=true) {
     StaticState<> w(std::forward<S>(sequences), std::move(p));
-    w.check_structure(em.pairable);
-    auto out = w.calculate_energy(em);
+    return detail::state_energy(w, em, distinguishable);
+}
+
+/******************************************************************************************/
+
+/**
+ * @brief Energies of many structures, evaluated in parallel over env
+ * Structures on the same strands share one System. Each task rebuilds a single StaticState
+ * in place, so its loop storage is reused across the structures the task evaluates.
+ * @param structures (strands, pair list) of each structure
+ * @return energy of each structure, in the same order
+ */
+template <class E, class Model>
+auto structure_energies(E &&env, vec<std::pair<StrandList, PairList>> const &structures, Model const &em, bool distinguishable=true) {
+    using T = no_qual<decltype(structure_energy(StrandList(), PairList(), em))>;
+    usize const n = len(structures);
+    vec<T> out(n);
+    if (!n) return out;
 
-    if (!distinguishable) out += std::log(real(w.symmetry())) / em.beta;
+    vec<std::shared_ptr<System const>> systems(n);
+    std::unordered_map<StrandList, std::shared_ptr<System const>, RangeHash<StrandList>> unique;
+    izip(structures, [&](auto i, auto const &s) {
+        auto &sys = unique[s.first];
+        if (!sys) sys = std::make_shared<System const>(s.first);
+        systems[i] = sys;
+    });
 
+    // a few contiguous blocks per worker, each reusing one state
+    usize const n_tasks = min(n, 4 * usize(env.n_workers()));
+    env.spread(span(0, n_tasks), 1, [&](auto const &, auto t, auto) {
+        StaticState<> w;
+        for (auto i : range(t * n / n_tasks, (t + 1) * n / n_tasks)) {
+            static_cast<StateBase &>(w) = StateBase(systems[i], structures[i].second);
+            w.loops.clear();
+            w.build();
+            out[i] = detail::state_energy(w, em, distinguishable);
+        }
+    });
     return out;
 }
 
@@ -7,12 +7,54 @@
  */
 #pragma once
 #include "../algorithms/TypeSupport.h"
-#include <functional>
+#include "../standard/Vec.h"
+#include <cstdint>
 
 namespace nupack {namespace thermo {
 
 /******************************************************************************************/
 
+/**
+ * Dense bit matrix over base pairs (i, j), precomputed once so that the QB recursion can
+ * test it inline. Indices may run up to 2n so that the duplicated complex used in the pair
+ * probability calculation maps back onto the original n x n mask.
+ */
+class PairMask {
+    vec<std::uint64_t> bits;
+    std::uint32_t n = 0, stride = 0; // stride is the number of words per row
+
+    std::uint32_t wrap(std::uint32_t i) const noexcept {return i < n ? i : i - n;}
+
+public:
+    PairMask() = default;
+
+    /// Mask over n bases with every pair initialized to value
+    explicit PairMask(std::uint32_t n, bool value=false) : n(n), stride((n + 63) / 64) {
+        bits.assign(std::size_t(n) * stride, value ? ~std::uint64_t(0) : 0);
+    }
+
+    /// Set both (i, j) and (j, i)
+    void set(std::uint32_t i, std::uint32_t j, bool value=true) noexcept {
+        i = wrap(i); j = wrap(j);
+        auto const flip = [&](std::uint32_t r, std::uint32_t c) {
+            auto &w = bits[std::size_t(r) * stride + c / 64];
+            auto const b = std::uint64_t(1) << (c % 64);
+            w = value ? (w | b) : (w & ~b);
+        };
+        flip(i, j); flip(j, i);
+    }
+
+    bool operator()(std::uint32_t i, std::uint32_t j) const noexcept {
+        i = wrap(i); j = wrap(j);
+        return (bits[std::size_t(i) * stride + j / 64] >> (j % 64)) & 1u;
+    }
+
+    std::uint32_t size() const noexcept {return n;}
+    bool empty() const noexcept {return n == 0;}
+};
+
+/******************************************************************************************/
+
 /**
  * Actions are called once for each base i, j during the calculation.
  * The boolean can_pair whether the thermodynamic model permits a pair between i and j
@@ -20,13 +62,15 @@ namespace nupack {namespace thermo {
  * The third argument is the slice of sequences being calculated
  * The fourth and fifth arguments are the indices of i and j
  * The last argument is the partition function matrices block Q
+ * PairingAction additionally forbids the pairs which are unset in its mask, which is tested
+ * inline; an empty mask permits all pairs.
  */
 struct PairingAction {
-    std::function<bool(int, int)> predicate; // treated as if it returns true if empty
+    PairMask mask;
 
     template <class Block, class Algebra, class F, class Model, class S>
     auto operator()(int i, int j, bool can_pair, Algebra A, Block const &, S const &s, Model const &, F &&recursion) const {
-        bool bad = !can_pair || (predicate && !predicate(i + s.offset, j + s.offset));
+        bool bad = !can_pair || (!mask.empty() && !mask(i + s.offset, j + s.offset));
         return bad ? A.zero() : A.maybe() & recursion();
     }
 };
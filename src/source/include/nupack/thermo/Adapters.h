@@ -35,7 +35,7 @@ template <class T> struct SquareBase : Tensor<T, 2> {
 
     /// preserve value (i, j) but set the exponent to the maximum of (i+1, j), (i, j-1), (i, j)
     void reset_exponent(uint i, uint j) {
-        if constexpr(!std::is_scalar_v<std::decay_t<T>>) {
+        if constexpr(!is_scalar_like<T>) {
             auto &&y = *base_type::operator()(i, j);
             auto e = y.second + max(0, simd::ifrexp(y.first).second);
             if (i < j) e = max(e, max(exponent(base_type::operator()(i+1, j)), exponent(base_type::operator()(i, j-1))));
@@ -48,7 +48,7 @@ template <class T> struct SquareBase : Tensor<T, 2> {
     template <class A, class F>
     bool set_value(bool ij, uint i, uint j, A const &, F &&rule) {
         bool err = false;
-        if constexpr(std::is_scalar_v<std::decay_t<T>>) {
+        if constexpr(is_scalar_like<T>) {
             *base_type::operator()(i, j) = A::rig_type::element_value(err, static_cast<F &&>(rule), Zero());
         } else {
             typename std::decay_t<T>::second_type e0;
@@ -74,7 +74,7 @@ template <class T> struct Upper : SquareBase<T> {
 
     template <class U>
     Upper(Upper<U> const &u) : base_type(u) {
-        if constexpr(!std::is_scalar_v<std::decay_t<T>>) {
+        if constexpr(!is_scalar_like<T>) {
             for (auto o : lrange(1, base_type::shape()[0]))
                 for (auto i : range(base_type::shape()[0] - o))
                     base_type::reset_exponent(i, i + o);
@@ -90,7 +90,7 @@ template <class T> struct Upper : SquareBase<T> {
     template <class M>
     void read(span is, span js, M const &m) {
         base_type::read(is, js, m);
-        if constexpr(!std::is_scalar_v<std::decay_t<T>>) {
+        if constexpr(!is_scalar_like<T>) {
             for (auto o : range(max(is.stop(), js.start()) - is.stop(), js.stop() - is.start()))
                 for (auto i : range(is.start(), js.stop() - o))
                     base_type::reset_exponent(i, i + o);
@@ -116,7 +116,7 @@ template <class T> struct Lower : SquareBase<T> {
 
     template <class U>
     Lower(Lower<U> const &u) : base_type(u) {
-        if constexpr(!std::is_scalar_v<std::decay_t<T>>)
+        if constexpr(!is_scalar_like<T>)
             for (auto o : lrange(1, base_type::shape()[0]))
                 for (auto i : range(base_type::shape()[0] - o))
                     base_type::reset_exponent(i + o, i);
@@ -136,7 +136,7 @@ template <class T> struct Lower : SquareBase<T> {
     template <class M>
     void read(span is, span js, M const &m) {
         base_type::read(js, is, m);
-        if constexpr(!std::is_scalar_v<std::decay_t<T>>) {
+        if constexpr(!is_scalar_like<T>) {
             for (auto o : range(max(is.stop(), js.start()) - is.stop(), js.stop() - is.start()))
                 for (auto i : range(is.start(), js.stop() - o))
                     base_type::reset_exponent(i + o, i);
@@ -155,7 +155,7 @@ template <class T> struct Symmetric : SquareBase<T> {
 
     template <class U>
     Symmetric(Symmetric<U> const &u) : base_type(u) {
-        if constexpr(!std::is_scalar_v<std::decay_t<T>>)
+        if constexpr(!is_scalar_like<T>)
             for (auto o : lrange(1, base_type::shape()[0]))
                 for (auto i : range(base_type::shape()[0] - o)) {
                     base_type::reset_exponent(i, i + o);
@@ -186,7 +186,7 @@ template <class T> struct Symmetric : SquareBase<T> {
     template <class M>
     void read(span is, span js, M const &m) {
         base_type::read(is, js, m);
-        if constexpr(!std::is_scalar_v<std::decay_t<T>>) {
+        if constexpr(!is_scalar_like<T>) {
             for (auto o : range(max(is.stop(), js.start()) - is.stop(), js.stop() - is.start()))
                 for (auto i : range(is.start(), js.stop() - o))
                     base_type::reset_exponent(i, i + o);
@@ -227,7 +227,7 @@ struct XTensor : MemberComparable {
         s[0] = (*X)[0];
         s[1] = (*X)[1];
         s[2] = (*X)[2];
-        if constexpr(!std::is_scalar_v<std::decay_t<T>>) {
+        if constexpr(!is_scalar_like<T>) {
             for (auto &&x : s) for (auto &&y : x) {
                 auto p = simd::ifrexp(y.first);
                 if (p.second > 0) {y.first = p.first; y.second += p.second;}
@@ -259,7 +259,7 @@ struct XTensor : MemberComparable {
 
     template <class U, NUPACK_IF(!is_ref<T> && !is_ref<U>)>
     XTensor(XTensor<U> const &x) : slices(vmap<slice_type>(x.slices, [](auto const &s) {return x_type{s[0], s[1], s[2]};})), prefixes(x.prefixes) {
-        if constexpr(std::is_scalar_v<std::decay_t<U>> && !std::is_scalar_v<std::decay_t<T>>) {
+        if constexpr(is_scalar_like<U> && !is_scalar_like<T>) {
             for (auto &s : slices) for (auto &&x : s) for (auto &&y : x) {
                 auto p = simd::ifrexp(y.first);
                 NUPACK_DASSERT(std::isfinite(p.first) && std::isfinite(y.first), p, y);
@@ -95,6 +95,15 @@ public:
     void copy_square(span i, span j) {
         for_each(members_of(*this), [=](auto &M) {M.copy_square(i, j);});
     }
+
+    /// Re-place the pages of each full matrix from the workers of env (see Tensor::first_touch)
+    /// Only valid for a fresh block, since every matrix is refilled with value
+    template <class E, class V>
+    void first_touch(E const &env, V const &value) {
+        for_each(members_of(*this), [&](auto &M) {
+            if constexpr(traits::is_like_tensor<decay<decltype(M)>>) M.first_touch(env, value);
+        });
+    }
 };
 
 NUPACK_DEFINE_TEMPLATE(is_block, Block, class, class);
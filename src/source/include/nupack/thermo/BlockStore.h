@@ -0,0 +1,79 @@
+/**
+ * @brief Persistent on-disk store of finished dynamic program block records
+ *
+ * @file BlockStore.h
+ */
+#pragma once
+#include "../reflect/Binary.h"
+#include "../types/Complex.h"
+#include "../standard/Optional.h"
+
+#include <string_view>
+
+namespace nupack::thermo {
+
+/******************************************************************************************/
+
+/// Read-only memory map of a whole file, empty if the file could not be opened
+class MappedFile {
+    void *address = nullptr;
+    std::size_t length = 0;
+    std::string fallback; // used where mmap is not available
+public:
+    explicit MappedFile(std::string const &path);
+    MappedFile(MappedFile const &) = delete;
+    MappedFile & operator=(MappedFile const &) = delete;
+    ~MappedFile();
+
+    std::string_view contents() const;
+    explicit operator bool() const {return length != 0;}
+};
+
+/******************************************************************************************/
+
+/**
+ * @brief Local file store of complete block records
+ * Each record is stored in its own file, named by the hash of its key and holding the full key
+ * for verification. The key is made of the model fingerprint, a tag for the record data type,
+ * and the strands of the complex in the order that the block was computed in.
+ * Files are written atomically (temporary file then rename) so concurrent processes may share a directory.
+ */
+class BlockStore {
+    std::string directory, fingerprint;
+
+    std::string key(Complex const &seq, std::string_view tag) const;
+    std::string path(std::string const &key) const;
+    void write(std::string const &key, std::string const &payload) const;
+    Optional<std::string_view> read(MappedFile const &file, std::string const &key) const;
+
+public:
+    /// directory is created if missing; fingerprint should identify the model parameters, conditions and ensemble
+    BlockStore(std::string directory, std::string fingerprint);
+
+    /// Save a record (not thread-safe with respect to the record, but safe with respect to the store)
+    template <class R>
+    void save(Complex const &seq, std::string_view tag, R const &r) const {
+        write(key(seq, tag), binary::dumps(r.contents));
+    }
+
+    /// Load a record if it is present and valid
+    template <class R>
+    Optional<R> load(Complex const &seq, std::string_view tag) const {
+        auto const k = key(seq, tag);
+        MappedFile const file(path(k));
+        if (auto const bytes = read(file, k)) {
+            R r;
+            // a corrupt record is a miss, like a corrupt header
+            try {r.contents = binary::loads<decltype(r.contents)>(bytes->data(), bytes->data() + bytes->size());}
+            catch (binary::FormatError const &) {return {};}
+            return r;
+        }
+        return {};
+    }
+
+    std::string const & location() const {return directory;}
+};
+
+/******************************************************************************************/
+
+}
@@ -1,6 +1,8 @@
 #pragma once
 #include "BasicBlock.h"
 #include "CoaxialBlock.h"
+#include "BlockStore.h"
+#include "Compression.h"
 #include "../types/LRU.h"
 #include "../standard/Variant.h"
 
@@ -18,16 +20,111 @@ using RecordType = BlockRecord<BlockMatrix<T, Ensemble, N>>;
 
 /**************************************************************************************/
 
-/// Convenience wrapper for LRU<...> cache class for easier use with variants
+/// Tag identifying a record data type in a BlockStore, e.g. "3-2-8-1" for N=3, MinDangles, overflow<double>
+template <class T, class Ensemble, int N>
+std::string record_tag() {
+    return std::to_string(N) + '-' + std::to_string(EnsembleType(Ensemble()).index()) + '-'
+        + std::to_string(sizeof(mantissa_t<T>)) + '-' + std::to_string(int(is_overflow<T>));
+}
+
+/**************************************************************************************/
+
+/// Value held by a Cache: a record of any of the given data types, either plain or compressed
 template <int N, class Ensemble, class ...Ts>
-struct Cache : LRU<Complex, MaybeVariant<RecordType<Ts, Ensemble, N>...>, MemoryLimit> {
-    using base_type = typename Cache::LRU;
+using CacheEntry = Variant<RecordType<Ts, Ensemble, N>..., CompressedRecord<RecordType<Ts, Ensemble, N>>...>;
+
+/**
+ * @brief Convenience wrapper for LRU<...> or ShardedLRU<...> cache class for easier use with variants
+ * Optionally backed by a BlockStore: complete records are saved to it when computed, and
+ * records missing from memory are looked up in it before being computed.
+ * If compress is set, new records are held as CompressedRecord so that more fit in the memory limit.
+ * @tparam Base LRU or ShardedLRU holding CacheEntry values
+ */
+template <class Base, int N, class Ensemble, class ...Ts>
+struct BasicCache : Base {
+    using base_type = Base;
+    using mapped_type = typename base_type::mapped_type;
     using is_lru = False;
-    Cache(std::size_t n=0) : base_type(n) {}
+    std::shared_ptr<BlockStore const> disk;
+    bool compress = false;
+
+    BasicCache(std::size_t n=0, bool compress=false) : base_type(n), compress(compress) {}
+    BasicCache(std::size_t n, std::shared_ptr<BlockStore const> d, bool compress=false) : base_type(n), disk(std::move(d)), compress(compress) {}
+
+    /// Convert a new record to the form it will be held in
+    template <class R>
+    mapped_type entry(R &&r) const {
+        if (compress) return CompressedRecord<decay<R>>(r);
+        return mapped_type(fw<R>(r));
+    }
+
+    /// Load a record from the disk tier into memory if it is not in memory already (thread-safe)
+    bool restore(Complex const &seq) {
+        if (!disk) return false;
+        auto &shard = base_type::shard(seq);
+        if (auto lock = shard.read_lock(); shard.find(seq) != shard.end()) return false;
+        bool found = false;
+        (void) std::initializer_list<bool>{(found = found || restore_as<Ts>(seq))...};
+        return found;
+    }
+
+    /// Save a record to the disk tier if it is complete (thread-safe)
+    template <class R>
+    void persist(Complex const &seq, R const &r) const {
+        using T = typename R::value_type;
+        if (disk && r.complete()) disk->save(seq, record_tag<T, Ensemble, N>(), r);
+    }
+
+private:
+    template <class T>
+    bool restore_as(Complex const &seq) {
+        using R = RecordType<T, Ensemble, N>;
+        auto r = disk->template load<R>(seq, record_tag<T, Ensemble, N>());
+        if (!r) return false;
+        auto &shard = base_type::shard(seq);
+        auto lock = shard.write_lock();
+        shard.try_emplace(seq, entry(std::move(*r)));
+        return true;
+    }
 };
 
+/// LRU holding the records of a Cache, with a given eviction policy
+template <template <class> class P, int N, class Ensemble, class ...Ts>
+using CacheLRU = LRU<Complex, CacheEntry<N, Ensemble, Ts...>, MemoryLimit, List, HashMap, P>;
+
+/// Cache evicting the least recently used records first
+template <int N, class Ensemble, class ...Ts>
+struct Cache : BasicCache<CacheLRU<RecencyPolicy, N, Ensemble, Ts...>, N, Ensemble, Ts...> {
+    using Cache::BasicCache::BasicCache;
+};
+
+/// Cache evicting the records which are cheapest to recompute per byte first (GreedyDual-Size)
+template <int N, class Ensemble, class ...Ts>
+struct CostAwareCache : BasicCache<CacheLRU<GreedyDualSizePolicy, N, Ensemble, Ts...>, N, Ensemble, Ts...> {
+    using CostAwareCache::BasicCache::BasicCache;
+};
+
+NUPACK_DETECT(has_disk_tier, decltype(declref<T>().disk));
+
+/// Convert a record to the form held by a given cache (only a Cache may compress)
+template <class C, class R>
+decltype(auto) cache_entry(C const &c, R &&r) {
+    if constexpr(traits::has_disk_tier<C>) return c.entry(fw<R>(r));
+    else return fw<R>(r);
+}
+
 NUPACK_DEFINE_VARIADIC(is_cache, Cache, int, class, class);
 
 /**************************************************************************************/
 
+/// Same as Cache but split into independently locked shards under one global memory limit
+template <int N, class Ensemble, class ...Ts>
+struct ShardedCache : BasicCache<ShardedLRU<Complex, CacheEntry<N, Ensemble, Ts...>>, N, Ensemble, Ts...> {
+    using ShardedCache::BasicCache::BasicCache;
+};
+
+NUPACK_DEFINE_VARIADIC(is_sharded_cache, ShardedCache, int, class, class);
+
+/**************************************************************************************/
+
 }
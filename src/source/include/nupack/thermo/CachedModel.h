@@ -14,40 +14,127 @@
 #include "../model/ParameterSet.h"
 
 #include <atomic>
+#include <mutex>
 
 namespace nupack::thermo {
 
 /******************************************************************************************/
 
+/// Factors whose tables grow with the longest sequence, as one immutable snapshot of capacity n
+template <class T>
+struct LengthTables {
+    Tensor<T, 2> alpha;               /// Multiloop factors
+    Tensor<T, 2> gamma;               /// Interior loop factors
+    Tensor<T, 1> asymmetry;
+    iseq n = 0;                       /// Number of bases that can be incorporated
+
+    NUPACK_REFLECT(LengthTables, alpha, gamma, asymmetry, n);
+};
+
+/**
+ * @brief LengthTables behind immutable snapshots which can grow while other threads read them
+ * Growth builds a new snapshot from the latest one and publishes it atomically. Readers hold a
+ * Reader while they use views into the tables; the superseded snapshots are freed as soon as no
+ * Reader is active, so only the latest snapshot is kept between programs.
+ */
+template <class T>
+class VersionedTables {
+    using snapshot = std::shared_ptr<LengthTables<T> const>;
+    mutable std::mutex mut;
+    snapshot newest = std::make_shared<LengthTables<T> const>();
+    vec<snapshot> retired; // superseded snapshots which an active Reader may still be using
+    std::atomic<LengthTables<T> const *> current{newest.get()};
+    std::atomic<std::size_t> readers{0};
+
+    snapshot latest_version() const {std::lock_guard<std::mutex> lock(mut); return newest;}
+
+    // with the lock held; the counter and current are sequentially consistent, so a Reader either
+    // is counted here or only ever sees the newest snapshot
+    void reclaim() {if (readers.load() == 0) retired.clear();}
+
+public:
+    /// Keeps every snapshot which latest() may have returned alive while it exists
+    class Reader {
+        VersionedTables *tables;
+    public:
+        explicit Reader(VersionedTables &t) : tables(&t) {t.readers.fetch_add(1);}
+        Reader(Reader const &) = delete;
+        Reader & operator=(Reader const &) = delete;
+        ~Reader() {
+            if (tables->readers.fetch_sub(1) != 1) return;
+            std::lock_guard<std::mutex> lock(tables->mut);
+            tables->reclaim();
+        }
+    };
+
+    VersionedTables() = default;
+    VersionedTables(VersionedTables const &o) : newest(o.latest_version()), current(newest.get()) {}
+
+    /// Not safe against concurrent readers of this object, like any other assignment
+    VersionedTables & operator=(VersionedTables const &o) {
+        if (this == &o) return *this;
+        auto s = o.latest_version();
+        std::lock_guard<std::mutex> lock(mut);
+        newest = std::move(s);
+        retired.clear();
+        current.store(newest.get());
+        return *this;
+    }
+
+    Reader reader() {return Reader(*this);}
+
+    /// Only valid while a Reader of this object exists (or no other thread can grow it)
+    LengthTables<T> const &latest() const noexcept {return *current.load();}
+
+    /// If capacity is below m, publish extend(latest(), m)
+    template <class F>
+    void grow(iseq m, F &&extend) {
+        std::lock_guard<std::mutex> lock(mut);
+        if (m <= newest->n) return; // another thread got here first
+        auto next = std::make_shared<LengthTables<T> const>(extend(*newest, m));
+        retired.emplace_back(std::move(newest));
+        newest = std::move(next);
+        current.store(newest.get());
+        reclaim();
+    }
+
+    void clear() {*this = VersionedTables();}
+};
+
+/******************************************************************************************/
+
 template <class T>
 struct ParameterCache {
     multi_array<T, 4, 4> terminal, mismatch_b;
     multi_array<T, 4, 4, 4, 4> mismatch;
 
-    // These members scale with length of maximum sequence so are kept mutable
-    mutable Tensor<T, 2> alpha;               /// Multiloop factors
-    mutable Tensor<T, 2> gamma;               /// Interior loop factors
-    mutable Tensor<T, 1> asymmetry;
+    // These tables scale with length of maximum sequence so are versioned (see VersionedTables)
+    mutable VersionedTables<T> length_tables;
     T multi1, multi2, multi12, multi22, multi122;
-    mutable iseq n=0;                   /// Number of bases that can be incorporated
 
-    void clear() {n = 0; alpha.clear(); gamma.clear(); asymmetry.clear();}
+    LengthTables<T> const &tables() const noexcept {return length_tables.latest();}
+    iseq capacity() const noexcept {return tables().n;}
+    /// Hold while reading the tables if another thread may reserve() concurrently
+    auto reader() const {return length_tables.reader();}
+
+    void clear() {length_tables.clear();}
 
-    template <class I> auto int_scale(I i) const {return mantissa_at(gamma(10, span(0, n)), i);}
-    template <class I> auto int_asym(I i) const {return mantissa_at(gamma(11, span(0, n)), i-4);}
-    template <class I> auto int_asym(int m, I i) const {return asymmetry(i + (n - m));}
+    template <class I> auto int_scale(I i) const {auto const &t = tables(); return mantissa_at(t.gamma(10, span(0, t.n)), i);}
+    template <class I> auto int_asym(I i) const {auto const &t = tables(); return mantissa_at(t.gamma(11, span(0, t.n)), i-4);}
+    template <class I> auto int_asym(int m, I i) const {auto const &t = tables(); return t.asymmetry(i + (t.n - m));}
 
-    auto bulge(span s) const {return gamma(8, s);}
-    auto rbulge(span s) const {return gamma(9, s.reversed(n));}
+    auto bulge(span s) const {return tables().gamma(8, s);}
+    auto rbulge(span s) const {auto const &t = tables(); return t.gamma(9, s.reversed(t.n));}
 
-    template <class I> auto int_size(I i) const {return gamma(12, i);}
-    template <class I> auto int_size(I i, iseq j) const {return gamma(j, i);}
-    auto int_rsize(span s, iseq j) const {return gamma(j+4, s.reversed(n));}
+    template <class I> auto int_size(I i) const {return tables().gamma(12, i);}
+    template <class I> auto int_size(I i, iseq j) const {return tables().gamma(j, i);}
+    auto int_rsize(span s, iseq j) const {auto const &t = tables(); return t.gamma(j+4, s.reversed(t.n));}
 
-    template <class I> auto multi3(I i) const {return alpha(0, i);}
-    auto multi3r(span s) const {return alpha(1, s.reversed(n));}
+    template <class I> auto multi3(I i) const {return tables().alpha(0, i);}
+    auto multi3r(span s) const {auto const &t = tables(); return t.alpha(1, s.reversed(t.n));}
 
-    NUPACK_REFLECT(ParameterCache, multi1, multi2, multi12, multi22, multi122, asymmetry, gamma, alpha, terminal, mismatch, mismatch_b, n);
+    // the length tables are derived data, rebuilt on demand after loading
+    NUPACK_REFLECT(ParameterCache, multi1, multi2, multi12, multi22, multi122, terminal, mismatch, mismatch_b);
 };
 
 NUPACK_DEFINE_TEMPLATE(is_parameter_cache, ParameterCache, class);
@@ -57,7 +144,7 @@ NUPACK_DEFINE_TEMPLATE(is_parameter_cache, ParameterCache, class);
 
 /**
  * @brief Model containing cached parameter values from an underlying energy Model
- * Only threadsafe if the capacity does not have to be increased
+ * Threadsafe for concurrent readers, including while the capacity is increased
  * @tparam Rig Algebraic rig (usually PF() or MFE())
  * @tparam Model An energy model like nupack::Model()
  */
@@ -95,7 +182,7 @@ public:
     constexpr T boltz(T e) const {return e;}
 
     template <class E, bool B=true, NUPACK_IF(B && !Rig::logarithmic::value)>
-    auto as_log(E e) const {return log(mantissa(e)) + exponent(e) * LogOf2;}
+    auto as_log(E e) const {return dual_log(mantissa(e)) + exponent(e) * LogOf2;}
 
     template <class E, bool B=true, NUPACK_IF(B && Rig::logarithmic::value)>
     auto as_log(E e) const {return e;}
@@ -185,16 +272,15 @@ public:
     explicit CachedModel(Model mod) : CachedModel(Rig(), std::move(mod)) {}
 
     /// Change the temperature, which means the cache must be cleared
-    void set_beta(T f) {energy_model.beta = f; *this = CachedModel(std::move(energy_model));}
+    void set_beta(T f) {energy_model.beta = f; energy_model.update_fingerprint(); *this = CachedModel(std::move(energy_model));}
 
     /// Interconversion between CachedModel() of a different type
     template <class M>
     explicit CachedModel(CachedModel<Rig, M> const &mod) : energy_model(mod.energy_model) {}
 
-    /// Calculate cached elements for calculation of sequence up to length n
-    void force_reserve(iseq m) const {
-        using C = base_type;
-        auto const all = span(0, m);
+    /// Extend the length dependent tables from old.n bases to m bases
+    /// Only the new forward entries are evaluated; the rest are copied from old
+    LengthTables<T> extend_tables(LengthTables<T> const &old, iseq const m) const {
         NUPACK_ASSERT(energy_model.valid(), "Empty model");
         // Newly inserted check. If parameters are perturbed to be very negative, an infinite Boltzmann factor
         // could be encountered. For instance, a 1000 length multiloop with a2 = -10.0.
@@ -202,41 +288,59 @@ public:
         // encountered during some parameter optimization trials.
         auto Q = [&](auto dG) {
             auto out = boltz(dG);
-            return (Rig::logarithmic::value || std::isfinite(out)) ? out : 0;
+            return (Rig::logarithmic::value || std::isfinite(primal(out))) ? out : 0;
         };
-
-        C::alpha.resize(2, m);
-        C::alpha(0, all).map([&](auto i) {return Q(i * energy_model.multi_base());});
-        C::alpha(1, all).assign(reversed(C::alpha(0, all)));
-
-        C::gamma.resize(13, m);
-        for (auto min : range(4)) for (auto i : range(min ? 0 : 1, m))
-            *C::gamma(4+min, m-i-1) = *C::gamma(min, i) = Q(std::min(i * energy_model.dG(ninio, min-1), energy_model.dG(ninio, ninio.back())) + energy_model.interior_size_energy(i+min+min));
-
-        for (auto s : range(1, min(m, bulge_size.size())))
-            *C::gamma(8, s) = Q(energy_model.dG(bulge_size, s - 1));
-        for (auto s : lrange(bulge_size.size(), m))
-            *C::gamma(8, s) = Q(energy_model.dG(bulge_size, bulge_size.back()) + std::log(s / 30.0) * energy_model.dG(log_loop_penalty));
-        C::gamma(9, all).assign(reversed(C::gamma(8, all)));
-
-        C::gamma(10, all).map([&](auto i) {
+        iseq const n = old.n;
+        auto const all = span(0, m), kept = span(0, n), added = span(n, m);
+        LengthTables<T> t;
+        t.n = m;
+
+        t.alpha.resize(2, m);
+        t.alpha(0, kept).assign(old.alpha(0, kept));
+        t.alpha(0, added).map([&](auto z) {return Q((n + z) * energy_model.multi_base());});
+        t.alpha(1, all).assign(reversed(t.alpha(0, all)));
+
+        t.gamma.resize(13, m);
+        for (auto r : {0, 1, 2, 3, 8, 10, 11, 12}) t.gamma(r, kept).assign(old.gamma(r, kept));
+
+        for (auto min : range(4)) for (auto i : range(std::max<iseq>(n, min ? 0 : 1), m))
+            *t.gamma(min, i) = Q(std::min(i * energy_model.dG(ninio, min-1), energy_model.dG(ninio, ninio.back())) + energy_model.interior_size_energy(i+min+min));
+        for (auto min : range(4)) t.gamma(4+min, all).assign(reversed(t.gamma(min, all)));
+
+        for (auto s : range(std::max<iseq>(n, 1), min(m, bulge_size.size())))
+            *t.gamma(8, s) = Q(energy_model.dG(bulge_size, s - 1));
+        for (auto s : lrange(std::max<iseq>(n, bulge_size.size()), m))
+            *t.gamma(8, s) = Q(energy_model.dG(bulge_size, bulge_size.back()) + std::log(s / 30.0) * energy_model.dG(log_loop_penalty));
+        t.gamma(9, all).assign(reversed(t.gamma(8, all)));
+
+        t.gamma(10, added).map([&](auto z) {
+            auto const i = n + z;
             return i == 0 ? 0 : Q(energy_model.interior_size_energy(i+2) - energy_model.interior_size_energy(i));
         });
-        C::gamma(11, all).map([&](auto i) {
-            return Q(energy_model.interior_asymmetry(i, 4) + energy_model.interior_size_energy(i+4));
+        t.gamma(11, added).map([&](auto z) {
+            return Q(energy_model.interior_asymmetry(n + z, 4) + energy_model.interior_size_energy(n + z + 4));
         });
-        C::gamma(12, all).map([&](auto i) {
+        t.gamma(12, added).map([&](auto z) {
+            auto const i = n + z;
             return i == 0 ? 0 : Q(energy_model.interior_size_energy(i));
         });
 
-        C::asymmetry.resize(2 * m);
-        C::asymmetry(span(0, 2*m)).map([&](auto i) {
-            return Q(energy_model.interior_asymmetry(i > m ? 4+i-m : 4+m-i, 4));
-        });
-        C::n = m;
-    };
+        // asymmetry(i) only depends on |i - m|, so the old table is the middle of the new one
+        t.asymmetry.resize(2 * m);
+        t.asymmetry(span(m - n, m + n)).assign(old.asymmetry(span(0, 2 * n)));
+        auto asym = [&](auto i) {return Q(energy_model.interior_asymmetry(i > m ? 4+i-m : 4+m-i, 4));};
+        t.asymmetry(span(0, m - n)).map(asym);
+        t.asymmetry(span(m + n, 2 * m)).map([&](auto z) {return asym(m + n + z);});
+        return t;
+    }
+
+    /// Calculate cached elements for calculation of sequence up to length m
+    /// Safe to call while other threads hold a reader() (see VersionedTables)
+    void force_reserve(iseq m) const {
+        base_type::length_tables.grow(m, [&](auto const &old, iseq c) {return extend_tables(old, c);});
+    }
 
-    iseq capacity() const {return this->n;}
+    using base_type::capacity;
     bool reserve(iseq m) const {return m > capacity() ? (force_reserve(m), true) : false;}
 };
 
@@ -0,0 +1,64 @@
+/**
+ * @brief Lossless compression of dynamic program records held in memory
+ *
+ * @file Compression.h
+ */
+#pragma once
+#include "Block.h"
+#include "../reflect/Binary.h"
+
+#include <string_view>
+
+namespace nupack::thermo {
+
+/******************************************************************************************/
+
+/**
+ * @brief Compress bytes by 64-bit words: each word is XORed with the one before it, runs of
+ * zero results are run-length encoded, and the rest keep only their nonzero low-order bytes.
+ * Fast for DP matrices, which have long runs of zeros and neighbouring values with equal exponents.
+ */
+std::string compress_words(std::string_view bytes);
+
+/// Invert compress_words()
+std::string decompress_words(std::string_view bytes);
+
+/******************************************************************************************/
+
+/// Compressed form of a Record, decompressed on access
+template <class R>
+struct CompressedRecord {
+    using record_type = R;
+    using value_type = typename R::value_type;
+    std::string bytes;
+    bool is_complete = false;
+    NUPACK_REFLECT(CompressedRecord, bytes, is_complete);
+
+    CompressedRecord() = default;
+
+    explicit CompressedRecord(R const &r) : bytes(compress_words(binary::dumps(r.contents))), is_complete(r.complete()) {
+        bytes.shrink_to_fit();
+    }
+
+    bool complete() const {return is_complete;}
+
+    R decompress() const {
+        auto const s = decompress_words(bytes);
+        R r;
+        r.contents = binary::loads<decltype(r.contents)>(s.data(), s.data() + s.size());
+        return r;
+    }
+};
+
+NUPACK_DEFINE_TEMPLATE(is_compressed_record, CompressedRecord, class);
+
+/// Return a record itself or its decompressed form
+template <class R>
+R const & decompressed(R const &r) {return r;}
+
+template <class R>
+R decompressed(CompressedRecord<R> const &r) {return r.decompress();}
+
+/******************************************************************************************/
+
+}
@@ -14,10 +14,12 @@
 #include "Sample.h"
 #include "Subopt.h"
 #include "Action.h"
+#include "Schedule.h"
 
 #include "../algorithms/Utility.h"
 #include "../reflect/Repr.h"
 #include "../types/IO.h"
+#include <chrono>
 #include "../thermo/Cache.h"
 
 namespace nupack::thermo {
@@ -54,6 +56,7 @@ struct Status {
     small_vec<Stat> errors; //< Stat for each strand: >=0 means that base index diagonal failed
     iseq diagonal = 0; //< the last incomplete diagonal: in terms of sequence indices, not base indices
     Optional<real> result; //< partition function result, if set
+    bool progress = true; //< whether run_program() counts its DP cells as job progress
     NUPACK_REFLECT(Status, errors, diagonal);
     /// At least one subblock at this diagonal has failed
     bool bad() const {return any_of(errors, [](Stat const &e) {NUPACK_DREQUIRE(e, !=, Stat::ready()); return e != Stat::finished();});}
@@ -72,6 +75,17 @@ struct Status {
 
 /**************************************************************************************/
 
+NUPACK_DETECT(has_numa_option, decltype(declref<T const>().numa()));
+
+/// Number of DP cells in the subblock of strands i and j: a triangle if i == j or only the lower half is needed
+template <class V>
+std::size_t subblock_cells(V const &pos, int i, int j, Region uplo) {
+    std::size_t const m = pos[i+1] - pos[i], n = pos[j+1] - pos[j];
+    return (i == j || uplo == Region::lower) ? m * (m + 1) / 2 : m * n;
+}
+
+/**************************************************************************************/
+
 /// Calculate a subblock without a cache
 /// Return and an int which is -1 if no errors and uplo of what had to be calculated
 template <class E, class K, class M, class B, class S, class V, class A>
@@ -82,38 +96,60 @@ std::pair<Stat, Region> subblock(E const &env, Stat diag, Region uplo, K const &
 
 /**
  * @brief Calculate a subblock and return what needed to be calculated: U=upper, L=lower, A=all, C=cached (none)
- * @todo split the mutex out of the cache sometime.
+ * The cache may be an LRU or a ShardedLRU, in which case only the shard holding seq is locked
  */
 template <class E, class K, class M, class C, class B, class S, class V, class A, NUPACK_IF(!is_same<False, C>)>
 std::pair<Stat, Region> subblock(E const &env, Stat diag, Region uplo, K const &seq, int i, int j,
                               M const &model, C &cache, B &block, S &sub, V const &pos, A const &action) {
-    if (!cache.limit.satisfiable()) {
+    auto &shard = cache.shard(seq); // the LRU (or one shard of it) which holds this key
+    if (!shard.limit.satisfiable()) {
         return subblock(env, diag, uplo, seq, i, j, model, False(), block, sub, pos, action);
     } else {
-        auto lock = cache.read_lock();
-        if (auto const it = cache.find(seq); it != cache.end()) { // computation has finished. read from cache
-            auto const done = fork(it->second, [&](auto const &r) -> uint {
-                if constexpr (max_log2<value_type_of<decltype(r)>>() > max_log2<value_type_of<B>>()) return 2; // go to ***
+        if constexpr(traits::has_disk_tier<C>) cache.restore(seq);
+        auto readable = [](auto const &r) { // false if overflow is implied to occur
+            return bool_t<(max_log2<value_type_of<decltype(r)>>() <= max_log2<value_type_of<B>>())>();
+        };
+        uint done = 3; // 3 if not in the cache
+        Optional<typename C::mapped_type> packed; // a compressed record is copied out and decompressed after unlocking
+        {
+            auto lock = shard.read_lock();
+            if (auto const it = shard.find(seq); it != shard.end()) done = fork(it->second, [&](auto const &r) -> uint {
+                if constexpr (!decltype(readable(r))::value) return 2; // go to ***
+                else if constexpr (traits::is_compressed_record<decay<decltype(r)>>) packed.emplace(r);
                 else block.read({pos[i], pos[i+1]}, {pos[j], pos[j+1]}, r);
                 return r.complete(); // 1 if record had whole square, 0 if just lower triangle
             });
-            if (done == 2) return {Stat(0), uplo}; // *** overflow implied to occur, so say it failed on diagonal 0
-            else if (done == 1 || uplo == Region::lower) return {Stat::finished(), Region::cached}; // block is all done
-            else uplo = Region::upper; // block is only partially done
         }
+        if (packed) fork(*packed, [&](auto const &r) {
+            if constexpr (decltype(readable(r))::value && traits::is_compressed_record<decay<decltype(r)>>)
+                block.read({pos[i], pos[i+1]}, {pos[j], pos[j+1]}, r.decompress());
+        });
+        if (done == 2) return {Stat(0), uplo}; // *** overflow implied to occur, so say it failed on diagonal 0
+        else if (done == 1 || (done == 0 && uplo == Region::lower)) // computation has finished. block is all done
+            return {Stat::finished(), Region::cached};
+        else if (done == 0) uplo = Region::upper; // block is only partially done
     }
 
+    auto const start = std::chrono::steady_clock::now();
     Stat err = run_block(env, diag, uplo, sub, (j != i), ForwardAlgebra<decltype(model.rig())>(), seq, model, action);
+    RecomputeCost const cost{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
 
     /// Put result in cache if the cache has less information than we computed
     if (err == Stat::finished()) {
-        auto lock = cache.write_lock();
-        bool already_done = false;
-        if (auto const it = cache.find(seq); it != cache.end()) // don't insert if uplo == lower or block is already complete
-            already_done = (uplo == Region::lower) || fork(it->second, [](auto const &x) {return x.complete();});
-        if (!already_done) {
-            cache.insert_or_assign(seq, block.write({pos[i], pos[i+1]}, {pos[j], pos[j+1]}, uplo != Region::lower));
+        Optional<BlockRecord<B>> record;
+        {
+            auto lock = shard.write_lock();
+            bool already_done = false;
+            if (auto const it = shard.find(seq); it != shard.end()) // don't insert if uplo == lower or block is already complete
+                already_done = (uplo == Region::lower) || fork(it->second, [](auto const &x) {return x.complete();});
+            if (!already_done) {
+                record.emplace(block.write({pos[i], pos[i+1]}, {pos[j], pos[j+1]}, uplo != Region::lower));
+                if constexpr(!traits::has_disk_tier<C>) shard.insert_or_assign(cost, seq, std::move(*record));
+                else shard.insert_or_assign(cost, seq, cache_entry(cache, *record));
+            }
         }
+        // write to the disk tier outside of the lock
+        if constexpr(traits::has_disk_tier<C>) if (record) cache.persist(seq, *record);
     }
     return {err, uplo};
 }
@@ -163,6 +199,11 @@ auto run_program(E const &env, Status &stat, Complex const &s, M const &model, B
 
     auto const list = s.views();
     if (!len(list) || !all_of(list, len)) return model.as_log(model.zero()); // edge cases
+    // On a NUMA executor, place the pages of a fresh block on the nodes of the workers
+    if constexpr(traits::has_numa_option<E>) if (stat.errors.empty() && env.numa()) block.first_touch(env, model.zero());
+    // Charge the block to the current job, if any, and count the DP cells of a fresh program as expected work
+    JobMemory const charge(ThreadLocalJob ? memory::measure(block) : 0);
+    if (stat.progress && stat.errors.empty()) expect_progress(len(s) * (len(s) + 1) / 2);
     // Prefix sums of the sizes for indexing
     auto const pos = prefixes(true, indirect_view(list, len));
     // Start at diagonal and head for the bottom left
@@ -178,12 +219,18 @@ auto run_program(E const &env, Status &stat, Complex const &s, M const &model, B
             std::tie(err, uplo) = subblock(env, err, uplo, k, i, i+o, model, cache, block, q, pos, action);
             if (err == Stat::finished()) {
                 auto const r = model.as_log(q.result());
-                observe(BlockMessage<B>{k.views(), std::move(q), r,
-                    model.complex_result(r, view(list, i, i+o+1)), static_cast<char>(uplo), o+1 != s.n_strands()});
+                observe(BlockMessage<B>{k.views(), std::move(q), primal(r),
+                    primal(model.complex_result(r, view(list, i, i+o+1))), static_cast<char>(uplo), o+1 != s.n_strands()});
             }
             return err;
         });
         if (stat.finish_diagonal(o)) break;
+        // count progress only once every block of the diagonal has finished, since after an
+        // overflow the whole diagonal is recomputed with a wider type
+        if (!stat.progress) continue;
+        std::size_t cells = 0;
+        for (auto i : indices(stat.errors)) cells += subblock_cells(pos, i, i+o, Region::all);
+        add_progress(cells);
     }
     auto const q = block.subsquare({0, len(s)}).result();
     auto m = mantissa(q);
@@ -213,6 +260,8 @@ real run_program(E const &env, Status &stat, std::array<Complex, 2> const &s, M
         block.copy_square({0, len(s[0])}, {len(s[0]), len(s[1])}); // copy duplicated complex subblock
     }
     fill(stat.errors, Stat::ready());
+    // the second half of the duplicated complex is about as many cells again
+    if (stat.progress && stat.diagonal == 0) expect_progress(len(s[0]) * (len(s[0]) + 1) / 2);
 
     auto const list = s[1].views();
     auto const pos = prefixes(true, indirect_view(s[1].views(), len));
@@ -232,13 +281,17 @@ real run_program(E const &env, Status &stat, std::array<Complex, 2> const &s, M
                     observe(BlockMessage<B>{k.views(), std::move(q), 0.0/0.0, 0.0/0.0, static_cast<char>(uplo), true});
                 } else {
                     auto const r = model.as_log(q.result());
-                    observe(BlockMessage<B>{k.views(), std::move(q), r, model.complex_result(r, view(list, i, i+o+1)), static_cast<char>(uplo), true});
+                    observe(BlockMessage<B>{k.views(), std::move(q), primal(r), primal(model.complex_result(r, view(list, i, i+o+1))), static_cast<char>(uplo), true});
                 }
             }
 
             return err;
         });
         if (stat.finish_diagonal(o)) break;
+        if (!stat.progress) continue;
+        std::size_t cells = 0;
+        for (auto o2 : indices(stat.errors)) cells += subblock_cells(pos, n-o2-1, n-o2-1+o, o == n ? Region::lower : Region::all);
+        add_progress(cells);
     }
     return *stat.result;
 }
@@ -282,6 +335,7 @@ void dispatch_type(Complex const &seq, Types, Ms const &models, C &cache, F &&f)
         });
 
         mod.reserve(len(seq));
+        auto const reading = mod.reader(); // other threads may grow the tables of a shared model meanwhile
         f(stat, *Q, mod, c);
         return stat.bad();
     })) throw std::overflow_error("overflow occurred in dynamic programs for all data types, seq = " + delimited_string(seq.views(), "+"));
@@ -333,6 +387,43 @@ auto dynamic_program(E &&env, Complex const &seq, Ms const &models, C &&cache={}
     return out;
 }
 
+/**************************************************************************************/
+
+/// Ensemble free energy and enthalpy (kcal/mol) and entropy (kcal/mol/K) of a complex
+struct EnsembleEnergies {
+    real free_energy, enthalpy, entropy;
+    NUPACK_REFLECT(EnsembleEnergies, free_energy, enthalpy, entropy);
+};
+
+/// CachedModel for ensemble_energies() with the same parameter file, conditions and pairing rules as a given model
+template <class T>
+auto dual_model(Model<T> const &m) {
+    auto const wobble = m.pairable.wobble_pairing ? WobblePairing::on : WobblePairing::off;
+    return CachedModel<DualPF, Model<Dual<T>>>(Model<Dual<T>>(m.ensemble, m.parameters.info.file, m.conditions, wobble));
+}
+
+/**
+ * @brief Ensemble free energy, enthalpy and entropy from a single dynamic program
+ * The model must be a DualPF model over Dual numbers (see dual_model()), so that log Q comes
+ * with its temperature derivative: G = -kT log Q, H = kT^2 d(log Q)/dT, S = (H - G) / T.
+ * There is no overflow fallback or cache for these programs.
+ */
+template <int N=3, class E, class Ms, class O=NoOp, class A=DefaultAction>
+EnsembleEnergies ensemble_energies(E &&env, Complex const &seq, Ms const &models, O const &observe={}, A const &action={}) {
+    Dual<real> logq;
+    real t = 0;
+    False no_cache;
+    dispatch_type_and_dangle<N>(seq, DataTypes<Ms>(), models, no_cache, [&](auto &stat, auto &Q, auto const &model, auto &&cache) {
+        static_assert(is_same<typename decay<decltype(model)>::rig_type, DualPF>, "ensemble_energies() requires a DualPF model");
+        logq = run_program(env, stat, seq, model, Q, cache, observe, action);
+        t = model.energy_model.conditions.temperature;
+    });
+    real const g = -Kb * t * logq.value, h = Kb * t * t * logq.slope;
+    return {g, h, (h - g) / t};
+}
+
+/**************************************************************************************/
+
 /// Calculate the partition function matrices for a sequence of strands  (see dynamic_program() for common parameters)
 template <int N=3, bool ...Bs, class E, class Ensemble, class Ms, class C=False, class O=NoOp, class A=DefaultAction>
 auto block(E &&env, Ensemble, Complex const &seq, Ms const &models, C &&cache={}, O const &observe={}, A const &action={}) {
@@ -468,6 +559,8 @@ auto bonus_pair_probability(E &&env, Complex const &seq, Ms const &models, C &&c
  * See dynamic_program() for common parameters
  * @param sets Ordered sets of strands to measure
  * @param cache Same as dynamic_program(), but if cache is a number, a cache of that max memory size will be used
+ * With a cache, the complexes and all of their contiguous subcomplexes are run as a ComplexSchedule,
+ * so each shared subblock is computed once and the longest chains of work are started first
  */
 template <int N=3, bool ...Bs, class E, class V, class Ms, class C=False, class O=NoOp, class A=DefaultAction>
 auto spread(E &&env, V sets, Ms const &models, C &&cache={}, O const &observe={}, A const &action={}) {
@@ -484,23 +577,53 @@ auto spread(E &&env, V sets, Ms const &models, C &&cache={}, O const &observe={}
     auto mods = as_tie(models);
     for_each(mods, [n=order.empty() ? 0 : len(order[0]->first)](auto &m) {m.reserve(n);});
 
+    // The programs overlap (a complex's subblocks are shared with or computed by others), so
+    // progress counts the cells of each distinct complex once, when its result is first known
+    auto const cells = [](Complex const &c) -> std::size_t {return len(c) * (len(c) + 1) / 2;};
+    expect_progress(sum(work, [&](auto const &w) {return cells(w.first);}));
+    std::mutex result_mut;
+    auto record = [&](auto const &m) {
+        observe(m);
+        Complex subseqs{m.sequences};
+        subseqs.rotate_lowest();
+        auto it = binary_search(work, subseqs, first_of);
+        if (it == std::cend(work)) return;
+        std::lock_guard lock(result_mut);
+        if (!it->second) add_progress(cells(it->first));
+        it->second.emplace(m.result);
+    };
+
     fork(first_of(mods).energy_model.ensemble_type(), [&](auto d) {
         using Ensemble = decltype(d);
-        // Make a new cache if it is given as a max memory size
-        // Run this on each set of sequences, putting in subsequence results too
+        if constexpr(!is_same<decay<C>, False>) {
+            // Make one shared cache if it is given as a max memory size
+            auto &&shared = if_c<is_arithmetic<decay<C>>>(cache, [](auto c) {
+                return Types::apply([c](auto ...ts) {return Cache<N, Ensemble, decltype(*ts)...>(c);});
+            }, Identity());
+            // Run every needed strand ordering once, children before parents, so each subblock is made once
+            // A cache of size 0 holds nothing, so then each complex is run alone as without a cache
+            if (shared.shard(Complex()).limit.satisfiable()) {
+                ComplexSchedule(vmap(work, first_of)).run(env, [&](auto const &env, Complex const &seq) {
+                    dispatch_type<N, Ensemble>(seq, Types(), mods, shared, [&](auto &stat, auto &Q, auto const &model, auto &&cache) {
+                        using OK = decltype(detail::check_cache_type(Q, cache));
+                        if (!OK::value) NUPACK_ERROR("incorrect cache type");
+                        False no_cache;
+                        stat.progress = false;
+                        run_program(env, stat, seq, model, Q, if_c<OK::value>(cache, no_cache), record, action);
+                    });
+                });
+                return;
+            }
+        }
+        // Without a cache, run this on each set of sequences, putting in subsequence results too
         env.spread(order, 1, [&](auto &&env, auto r, auto const &idx) {
-            if (r->second) return;
+            {std::lock_guard lock(result_mut); if (r->second) return;}
             dispatch_type<N, Ensemble>(r->first, Types(), mods, cache, [&](auto &stat, auto &Q, auto const &model, auto &&cache) {
                 using OK = decltype(detail::check_cache_type(Q, cache));
                 if (!OK::value) NUPACK_ERROR("incorrect cache type");
                 False no_cache;
-                run_program(env, stat, r->first, model, Q, if_c<OK::value>(cache, no_cache), [&](auto const &m) {
-                    observe(m);
-                    Complex subseqs{m.sequences};
-                    subseqs.rotate_lowest();
-                    auto it = binary_search(work, subseqs, first_of);
-                    if (it != std::cend(work)) it->second.emplace(m.result);
-                }, action);
+                stat.progress = false;
+                run_program(env, stat, r->first, model, Q, if_c<OK::value>(cache, no_cache), record, action);
             });
         });
     });
@@ -0,0 +1,153 @@
+/**
+ * @brief Gradients of log partition functions with respect to the energy parameters
+ *
+ * @file Gradient.h
+ */
+#pragma once
+#include "Engine.h"
+#include "../model/ParameterGradient.h"
+#include "../types/Database.h"
+
+namespace nupack::thermo {
+
+NUPACK_DETECT(has_coaxial_rows, decltype(declval<T>().coax));
+
+/******************************************************************************************/
+
+/// log Q of a complex and its gradient with respect to each entry of the model's ParameterData
+struct LogPfuncGradient {
+    real log_pfunc = 0;
+    vec<real> gradient;
+    NUPACK_REFLECT(LogPfuncGradient, log_pfunc, gradient);
+};
+
+/// Models for log_pfunc_gradient(): one to run the partition function and one over ParameterDual
+/// numbers (see gradient_model()) to differentiate each recursion term in the outside sweep
+template <class T>
+struct GradientModels {
+    CachedModel<PF, Model<T>> forward;
+    CachedModel<DualPF, Model<ParameterDual<T>>> local;
+};
+
+template <class T>
+GradientModels<T> gradient_pf_model(Model<T> const &m) {return {CachedModel<PF, Model<T>>(m), CachedModel<DualPF, Model<ParameterDual<T>>>(gradient_model(m))};}
+
+/**
+ * @brief d(log Q)/d(theta) by one outside (adjoint) sweep over a finished partition function block
+ * The block is copied into ParameterDual numbers with zero slopes, and its helper tables such as
+ * the coaxial stacking rows are refilled from the model so that they carry their derivatives.
+ * Replaying a recursion with the backward algebra then gives each term with its derivative
+ * while the elements it multiplies are held fixed. Going from the longest span down (and within a
+ * cell, against the order of Base::recursions()), each element's adjoint d(log Q)/d(element)
+ * times a term's slope is added to the gradient, and times the term over a factor's value is
+ * added to that factor's adjoint.
+ */
+template <class U, class Base, class M, class A>
+vec<real> outside_gradient(Block<U, Base> const &block, Complex const &seq, M const &model, A const &action) {
+    using T = value_type_of<M>;
+    using Algebra = SuboptAlgebra<typename M::rig_type>;
+    constexpr auto n_members = std::tuple_size_v<decltype(Base::recursions())>;
+
+    Block<T, Base> dual(block);
+    if constexpr(traits::has_coaxial_rows<decltype(dual)>) dual.coax.initialize(seq, model);
+    auto const mems = members_of(dual);
+    iseq const n = len(seq);
+
+    std::array<vec<real>, n_members> adjoint;
+    for_each_index(indices_up_to<n_members>(), [&](auto I) {
+        if constexpr(traits::is_like_tensor<decay<decltype(at_c(mems, I))>>) {
+            adjoint[I].assign(n * n, 0);
+            if (at_c(names_of(dual), I) == "Q") adjoint[I][n-1] = 1 / primal(block.result());
+        }
+    });
+    // Add w / value to the adjoint of the element which t points to, if any
+    auto pass = [&](auto const &t, real w) {
+        for_each_index(indices_up_to<n_members>(), [&](auto I) {
+            if constexpr(traits::is_like_tensor<decay<decltype(at_c(mems, I))>>) if (at_c(mems, I).has(t)) {
+                auto const ij = minmax(at_c(mems, I).indices_of(t));
+                adjoint[I][ij[0] * n + ij[1]] += w / primal(value_of(t));
+            }
+        });
+    };
+
+    vec<real> out(ParameterData<real>::size, 0);
+    for (iseq o = n; o--;) for (iseq i = 0; i + o < n; ++i) {
+        iseq const j = i + o;
+        auto const s = seq.strands_included(i, j);
+        auto sub = dual.subsquare(span{s.offset, s.offset + len(s)});
+        for_each_index(indices_up_to<n_members>(), [&](auto K) {
+            constexpr auto I = size_constant<n_members - 1 - decltype(K)::value>();
+            auto const rule = at_c(Base::recursions(), I);
+            if constexpr(traits::is_like_tensor<decay<decltype(at_c(mems, I))>> && !is_same<decltype(rule), True const>) {
+                real const a = adjoint[I][i * n + j];
+                if (a == 0) return;
+                auto const elem = value_of(at_c(mems, I)(i, j));
+                auto replay = [&](auto multi) {
+                    Algebra::recurse([&](auto result, auto const &...ts) {
+                        T const term = result(-exponent(elem));
+                        if (term.value == 0) return false;
+                        term.slope.add_to(out, a);
+                        NUPACK_UNPACK(pass(ts, a * term.value));
+                        return false;
+                    }, rule(i - s.offset, j - s.offset, multi, Algebra(), sub, s, model, action));
+                };
+                if (s.multi()) replay(MultiStrand());
+                else replay(SingleStrand());
+            }
+        });
+    }
+    // the join penalties are applied outside of the block
+    model.complex_result(T(0), seq.views()).slope.add_to(out);
+    return out;
+}
+
+/**
+ * @brief Exact gradient of log Q with respect to every parameter entry of a model
+ * One partition function program over real numbers, then an outside sweep (see outside_gradient())
+ * which replays each recursion once, so the cost does not grow with the number of parameters.
+ * An overflow of the partition function raises std::overflow_error: the sweep needs plain
+ * element values, so there is no retry with a wider type.
+ * @param models forward and local models for the same energy model (see gradient_pf_model())
+ */
+template <int N=3, class E, class T, class A=DefaultAction>
+LogPfuncGradient log_pfunc_gradient(E &&env, Complex const &seq, GradientModels<T> const &models, A const &action={}) {
+    LogPfuncGradient out;
+    auto const forward = std::tie(models.forward);
+    False no_cache;
+    dispatch_type_and_dangle<N>(seq, DataTypes<decltype(forward)>(), forward, no_cache, [&](auto &stat, auto &Q, auto const &model, auto &cache) {
+        out.log_pfunc = run_program(env, stat, seq, model, Q, cache, NoOp(), action);
+        if (stat.bad() || !std::isfinite(out.log_pfunc)) return;
+        models.local.reserve(len(seq));
+        auto const reading = models.local.reader();
+        out.gradient = outside_gradient(Q, seq, models.local, action);
+    });
+    if (out.gradient.empty()) out.gradient.assign(ParameterData<T>::size, 0); // empty complex
+    if (!std::all_of(out.gradient.begin(), out.gradient.end(), [](real g) {return std::isfinite(g);}))
+        throw std::overflow_error("non-finite log partition function gradient, seq = " + delimited_string(seq.views(), "+"));
+    return out;
+}
+
+/******************************************************************************************/
+
+/**
+ * @brief log Q gradients for every record of a partition function database
+ * Records are keyed by their '+'-separated strand sequences; T is in degrees Celsius as in the
+ * reference data. Models are cached across records which share material and conditions, so a
+ * parameter fit over the database rebuilds each CachedModel once per evaluation.
+ */
+template <class E>
+auto pfunc_gradients(E &&env, JsonDatabase<std::map<string, PfuncDatum>> const &db, Ensemble ensemble) {
+    std::map<string, LogPfuncGradient> out;
+    std::map<std::tuple<string, real, real, real>, decltype(gradient_pf_model(Model<real>()))> models;
+    for (auto const &[key, d] : db) {
+        auto it = models.find({d.material, d.T, d.sodium, d.magnesium});
+        if (it == models.end()) it = models.emplace(std::make_tuple(d.material, d.T, d.sodium, d.magnesium), gradient_pf_model(
+            Model<real>(ensemble, ParameterFile(d.material), ModelConditions{d.T + ZeroCinK, d.sodium, d.magnesium}))).first;
+        out.emplace(key, log_pfunc_gradient(env, Complex(to_sequences<StrandList>(key)), it->second));
+    }
+    return out;
+}
+
+/******************************************************************************************/
+
+}
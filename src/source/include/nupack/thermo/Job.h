@@ -0,0 +1,118 @@
+/**
+ * @brief Asynchronous, cancellable thermo jobs with progress reporting and resource limits
+ *
+ * @file Job.h
+ */
+#pragma once
+#include "../execution/Local.h"
+#include "../reflect/Reflection.h"
+
+#include <future>
+
+namespace nupack::thermo {
+
+/******************************************************************************************/
+
+/// Per-job resource limits; zero means no limit
+struct JobLimits {
+    real seconds = 0; //< wall time from submission
+    std::size_t bytes = 0; //< dynamic program blocks held at once
+
+    NUPACK_REFLECT(JobLimits, seconds, bytes);
+};
+
+/******************************************************************************************/
+
+/**
+ * @brief Handle to a job running in the background
+ * Copies refer to the same job. Progress is the fraction of expected dynamic program cells
+ * which have been filled; the expected total grows as the job discovers more programs to
+ * run, so progress is an estimate which is exact only once the job has finished.
+ */
+template <class T>
+class Job {
+    std::shared_ptr<JobControl> control;
+    std::shared_future<T> future;
+
+public:
+    Job() = default;
+    Job(std::shared_ptr<JobControl> c, std::shared_future<T> f) : control(std::move(c)), future(std::move(f)) {}
+
+    bool valid() const {return future.valid();}
+
+    /// Estimated fraction of the job done, in [0, 1]
+    double progress() const {return control ? control->progress() : 0;}
+
+    /// Whether the result (or the exception) is available
+    bool ready() const {return valid() && future.wait_for(0s) == std::future_status::ready;}
+
+    /// Wait up to the given number of seconds and return whether the job is ready
+    bool wait(real seconds) const {
+        return valid() && future.wait_for(chrono::duration<real>(seconds)) == std::future_status::ready;
+    }
+
+    /// Ask the job to stop; it throws JobInterrupted at its next check (at most a few DP diagonals later)
+    void cancel() const {if (control) control->request_stop(JobStop::cancelled);}
+
+    /// Hold the job's threads at their next check until resume(), cancel() or its deadline
+    void pause() const {if (control) control->pause();}
+    void resume() const {if (control) control->resume();}
+
+    /// Why the job was stopped, if it was
+    JobStop stopped() const {return control ? control->stopped() : JobStop::none;}
+
+    /// Bytes of dynamic program blocks currently charged to the job
+    std::size_t memory() const {return control ? control->memory.load() : 0;}
+
+    /// Block until the job finishes and return its result, rethrowing any exception it raised
+    T const & get() const {
+        if (!valid()) NUPACK_ERROR("job has no result");
+        return future.get();
+    }
+};
+
+/******************************************************************************************/
+
+/**
+ * @brief Runs thermo jobs in the background on one shared parallel executor
+ * Each job gets its own thread, which installs the job's control so that the executor's
+ * workers, throw_if_signal(), and the dynamic programs observe its progress and limits.
+ * All jobs share the same worker arena, so submitting many jobs does not oversubscribe the host.
+ */
+class JobExecutor {
+    Local env;
+
+public:
+    explicit JobExecutor(Local e=Local()) : env(std::move(e)) {}
+
+    Local const & executor() const {return env;}
+    auto n_workers() const {return env.n_workers();}
+
+    /// Start f(env) in the background and return a handle to its result
+    /// If paused, the job waits before doing any work until it is resumed (see Job::pause())
+    template <class F>
+    auto submit(F &&f, JobLimits const &limits={}, bool paused=false) const {
+        using T = std::decay_t<decltype(f(env))>;
+        auto control = std::make_shared<JobControl>();
+        if (paused) control->pause();
+        if (limits.seconds > 0) control->deadline = chrono::steady_clock::now()
+            + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<real>(limits.seconds));
+        control->memory_limit = limits.bytes;
+
+        auto future = std::async(std::launch::async, [control, env=env, f=std::forward<F>(f)]() mutable -> T {
+            ThreadLocalJob = control;
+            struct Reset {~Reset() {ThreadLocalJob.reset();}} reset;
+            control->check(); // cancelled or paused before it started
+            T out = f(std::as_const(env));
+            auto const total = std::max<std::size_t>(control->total.load(), 1);
+            control->total.store(total);
+            control->done.store(total);
+            return out;
+        });
+        return Job<T>(std::move(control), future.share());
+    }
+};
+
+/******************************************************************************************/
+
+}
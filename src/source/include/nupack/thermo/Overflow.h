@@ -15,8 +15,8 @@
 
 namespace nupack {
 
-NUPACK_DETECT(is_scalar_range, void_if<is_scalar<value_type_of<T>>>);
-NUPACK_DETECT(is_compound_range, void_if<!is_scalar<value_type_of<T>>>);
+NUPACK_DETECT(is_scalar_range, void_if<is_scalar_like<value_type_of<T>>>);
+NUPACK_DETECT(is_compound_range, void_if<!is_scalar_like<value_type_of<T>>>);
 
 /******************************************************************************************/
 
@@ -176,16 +176,16 @@ auto exponent(P &&p, T hint) -> decltype(p->second + hint) {return p->second + h
 
 /******************************************************************************************/
 
-template <class P, class T=Zero, NUPACK_IF(!is_class<decay<decltype(*std::declval<P>())>>)>
+template <class P, class T=Zero, NUPACK_IF(is_scalar_like<decltype(*std::declval<P>())>)>
 decltype(auto) mantissa(P &&p, T={}) {return *p;}
 
-template <class P, class T=Zero, NUPACK_IF(!is_class<decay<P>>)>
+template <class P, class T=Zero, NUPACK_IF(!is_class<decay<P>> || is_dual<decay<P>>)>
 remove_rref<P &&> mantissa(P &&p, T={}) {return fw<P>(p);}
 
-template <class P, class T=Zero, NUPACK_IF(!is_class<decay<decltype(*std::declval<P>())>>)>
+template <class P, class T=Zero, NUPACK_IF(is_scalar_like<decltype(*std::declval<P>())>)>
 T exponent(P const &, T hint={}) {return hint;}
 
-template <class P, class T=Zero, NUPACK_IF(!is_class<P>)>
+template <class P, class T=Zero, NUPACK_IF(!is_class<P> || is_dual<P>)>
 T exponent(P const &, T hint={}) {return hint;}
 
 /******************************************************************************************/
@@ -221,7 +221,10 @@ namespace nupack::simd {
 template <class O, class F>
 void map(O &&out, int i, int stop, F &&f) noexcept {
 
-    if constexpr(std::is_scalar_v<value_type_of<O>>) {
+    if constexpr(::nupack::traits::is_dual<value_type_of<O>>) {
+        // no packed path for Duals
+        for (; i < stop; ++i) *(begin_of(out) + i) = f(i).first;
+    } else if constexpr(std::is_scalar_v<value_type_of<O>>) {
         constexpr auto Z = pack_size<value_type_of<O>>;
         for (; i + Z <= stop; i += Z)
             bs::store(f(Chunk<Z>(i)).first, std::addressof(*(begin_of(out) + i)));
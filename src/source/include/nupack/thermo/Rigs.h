@@ -113,4 +113,53 @@ struct MFE {
 
 /******************************************************************************************/
 
+/// Elementwise operations for values Boost.SIMD can't pack; Zero exponents pass through +
+struct scalar_plus {
+    constexpr Zero operator()(Zero, Zero) const {return {};}
+    template <class T, class U>
+    constexpr auto operator()(T const &t, U const &u) const {return t + u;}
+};
+
+struct scalar_times {
+    template <class T, class U>
+    constexpr auto operator()(T const &t, U const &u) const {return t * u;}
+};
+
+struct scalar_invert {
+    template <class T>
+    constexpr auto operator()(T const &t) const {return 1 / t;}
+};
+
+/**
+ * @brief The PF ring over Dual numbers: each element carries its derivative with respect to
+ * temperature, or its gradient with respect to the parameters for a ParameterDual.
+ * There is no overflow type or SIMD path, so it is only for modest partition functions.
+ */
+struct DualPF {
+    using logarithmic = False;
+    static constexpr auto zero() {return *::nupack::zero;}
+    static constexpr auto one() {return *::nupack::one;}
+    static constexpr auto plus() {return scalar_plus();}
+    static constexpr auto plus_eq() {return ::nupack::plus_eq;}
+    static constexpr auto times() {return scalar_times();}
+    static constexpr auto invert() {return scalar_invert();}
+    static constexpr auto sum() {return Identity();}
+    static constexpr auto ldexp() {return first_arg();}
+
+    template <class T, class S>
+    static bool prevent_overflow(Dual<T, S> &m) {
+        if (unlikely(PF::prevent_overflow(m.value) || !all_finite(m.slope))) {m = 0; return true;}
+        else return false;
+    }
+
+    template <class E, class F>
+    static auto element_value(bool &err, F &&rule, E e) {
+        auto m = mantissa(fw<F>(rule), -e);
+        err = prevent_overflow(m);
+        return m;
+    }
+};
+
+/******************************************************************************************/
+
 }}
@@ -8,6 +8,7 @@
 #pragma once
 #include "../iteration/Range.h"
 #include "../common/Error.h"
+#include "../algorithms/Dual.h"
 #include "../reflect/Print.h"
 #include <boost/simd/pack.hpp>
 #include <boost/simd/function/saturated.hpp> // needed to fix compiling on EC2 for some reason
@@ -84,7 +85,7 @@ namespace bs = boost::simd;
 
 static auto ifrexp = bs::pedantic_(bs::ifrexp);
 
-template <class T> static constexpr bool can_simd = (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+template <class T> static constexpr bool can_simd = std::is_arithmetic_v<T> && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
 
 /// pack_size is the default number of elements in a SIMD pack suggested by Boost.SIMD
 template <class T>
@@ -131,19 +132,26 @@ template <class R, class D, class M, class Op>
 auto map_reduce(R reduce, D domain, M map, Op op) {
     auto it = begin_of(domain);
     auto ret = map(*it++);
-    constexpr auto Z = pack_size<decltype(ret)>;
-    if (it + Z <= end_of(domain)) {
-        auto sum = map(Chunk<Z>(*it));
-        for (it += Z; it + Z <= end_of(domain); it += Z) reduce(sum, map(Chunk<Z>(*it)));
-        reduce(ret, op(sum));
+    if constexpr(can_simd<decltype(ret)>) {
+        constexpr auto Z = pack_size<decltype(ret)>;
+        if (it + Z <= end_of(domain)) {
+            auto sum = map(Chunk<Z>(*it));
+            for (it += Z; it + Z <= end_of(domain); it += Z) reduce(sum, map(Chunk<Z>(*it)));
+            reduce(ret, op(sum));
+        }
     }
     for (; it != end_of(domain); ++it) reduce(ret, map(*it));
     return ret;
 }
 
-/// Shorthand for the default allocator that should be used
+namespace detail {
+    template <class T, class=void> struct pack_alignment {static constexpr std::size_t value = alignof(T);};
+    template <class T> struct pack_alignment<T, void_if<can_simd<T>>> {static constexpr std::size_t value = bs::pack<T>::alignment;};
+}
+
+/// Shorthand for the default allocator that should be used (element alignment for types Boost.SIMD can't pack)
 template <class T>
-using allocator = boost::alignment::aligned_allocator<T, bs::pack<T>::alignment>;
+using allocator = boost::alignment::aligned_allocator<T, detail::pack_alignment<T>::value>;
 
 /******************************************************************************************/
 
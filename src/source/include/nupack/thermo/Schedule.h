@@ -0,0 +1,95 @@
+/**
+ * @brief Dependency graph of complexes and their contiguous subcomplexes for cached dynamic programs
+ *
+ * @file Schedule.h
+ */
+#pragma once
+#include "../types/Complex.h"
+#include "../standard/Map.h"
+#include "../iteration/Range.h"
+
+#include <algorithm>
+
+namespace nupack::thermo {
+
+/******************************************************************************************/
+
+/**
+ * @brief DAG whose nodes are the exact strand orderings whose blocks a set of complexes needs
+ * A complex of n strands depends on its two contiguous subcomplexes of n-1 strands, so running
+ * the nodes in topological order against a shared cache computes every subblock once: by the
+ * time a node runs, all of its off-diagonal subblocks are already in the cache.
+ * Nodes are prioritized by the largest total cost of any chain from the node to a requested
+ * complex, so that the critical path is started as early as possible.
+ */
+class ComplexSchedule {
+    struct Node {
+        Complex sequence;
+        small_vec<uint, 2> children;
+        small_vec<uint> parents;
+        real priority = 0;
+    };
+    vec<Node> nodes;
+    HashMap<Complex, uint> index;
+
+    uint add(Complex c) {
+        if (auto it = index.find(c); it != index.end()) return it->second;
+        uint const k = len(nodes);
+        index.emplace(c, k);
+        nodes.emplace_back(Node{std::move(c)});
+        auto const n = nodes[k].sequence.n_strands();
+        if (n > 1) {
+            auto const lhs = add(nodes[k].sequence.slice(0, n - 1));
+            auto const rhs = add(nodes[k].sequence.slice(1, n));
+            for (auto ch : {lhs, rhs}) if (!contains(nodes[k].children, ch)) {
+                nodes[k].children.emplace_back(ch);
+                nodes[ch].parents.emplace_back(k);
+            }
+        }
+        return k;
+    }
+
+public:
+    /// Estimated relative cost of the top-level block of a node
+    static real cost(Complex const &c) {real const n = len(c); return n * n * n;}
+
+    ComplexSchedule() = default;
+
+    /// Build the graph for the given complexes in their given strand orders
+    template <class V>
+    explicit ComplexSchedule(V const &complexes) {
+        for (auto const &c : complexes) add(Complex(c));
+        // parents always have more strands than their children
+        auto order = vmap<vec<uint>>(indices(nodes), [](auto i) {return uint(i);});
+        std::sort(order.begin(), order.end(), [&](uint i, uint j) {return nodes[i].sequence.n_strands() > nodes[j].sequence.n_strands();});
+        for (auto k : order) {
+            real up = 0;
+            for (auto p : nodes[k].parents) up = max(up, nodes[p].priority);
+            nodes[k].priority = up + cost(nodes[k].sequence);
+        }
+    }
+
+    auto size() const {return len(nodes);}
+    Complex const & operator[](uint k) const {return nodes[k].sequence;}
+
+    /**
+     * @brief Call f(env, sequence) on every node, each after all of its children have finished
+     * Nodes without children are started in order of priority; every other node is started as a new
+     * task of env by its last child to finish, so no worker waits for work to become ready.
+     * Each f may use env for its own parallelism.
+     * If any f throws, no further nodes are started and the first exception is rethrown.
+     */
+    template <class E, class F>
+    void run(E const &env, F &&f) const {
+        auto pending = vmap<vec<uint>>(nodes, [](auto const &n) {return uint(len(n.children));});
+        vec<uint> roots;
+        for (auto k : indices(nodes)) if (!pending[k]) roots.emplace_back(k);
+        std::sort(roots.begin(), roots.end(), [&](uint i, uint j) {return nodes[i].priority > nodes[j].priority;});
+        env.dataflow(pending, roots, [&](uint k) -> auto const & {return nodes[k].parents;},
+            [&](auto const &env, uint k) {f(env, nodes[k].sequence);});
+    }
+};
+
+/******************************************************************************************/
+
+}
@@ -4,6 +4,7 @@
 #include "../reflect/Reflection.h"
 #include "../common/Error.h"
 #include "../standard/Vec.h"
+#include "../execution/Numa.h"
 #include <ios>
 #include <iomanip>
 
@@ -281,6 +282,24 @@ public:
         base_type::resize(m * n);
     }
 
+    /// Release the pages of the matrix, interleave them across the NUMA nodes, and refill it with t
+    /// row by row from the workers of env. Each diagonal of the sweep is split over the workers
+    /// differently, so no row partition keeps a worker's cells local; interleaving instead spreads
+    /// every worker's traffic evenly over the nodes. Without mbind, the pages are placed by the
+    /// worker which fills each band of rows.
+    template <class E, class U>
+    void first_touch(E const &env, U const &t) {
+        if constexpr(std::is_trivially_destructible_v<T>) {
+            if (!product(dims)) return;
+            auto const bytes = base_type::storage.size() * sizeof(T);
+            numa::release_pages(base_type::storage.data(), bytes);
+            numa::interleave_pages(base_type::storage.data(), bytes);
+            env.spread(span(0, dims[0]), 1, [&](auto &&, iseq i, auto) {
+                base_type::fill(T(t), {i * dims[1], (i + 1) * dims[1]});
+            }, env.even_split());
+        }
+    }
+
     auto shape() const noexcept {return dims;}
     constexpr auto strides() const noexcept {return std::array<iseq, 2>{dims[1], 1};}
     auto size() const noexcept {return dims[0];}
@@ -1,6 +1,9 @@
 #pragma once
 #include <string>
 #include <string_view>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "Sequence.h"
 
@@ -94,6 +97,93 @@ public:
 
 /******************************************************************************************/
 
+/**
+ * @brief Handle to the lowest rotation of a Complex, whose rotation, hash, and id are computed once
+ * Handles interned by the same ComplexTable share one entry, so their equality is a pointer
+ * comparison; other handles compare by hash and then by complex. An entry lives as long as
+ * some handle to it.
+ */
+class CanonicalComplex : TotallyOrdered {
+public:
+    struct Entry {
+        Complex complex; // lowest rotation
+        std::size_t hash;
+        uint id;
+    };
+
+private:
+    friend class ComplexTable;
+    std::shared_ptr<Entry const> entry;
+    uint shift = 0; // number of strands the original complex was rotated by
+
+    CanonicalComplex(std::shared_ptr<Entry const> e, uint s) : entry(std::move(e)), shift(s) {}
+
+public:
+    using simple_type = True;
+
+    CanonicalComplex() : CanonicalComplex(Complex()) {}
+    /// Make a handle which is not interned in any table (its id is 0)
+    explicit CanonicalComplex(Complex const &c);
+
+    Complex const & complex() const {return entry->complex;}
+    std::size_t hash() const {return entry->hash;}
+    /// Small integer unique to this complex up to rotation within its ComplexTable, assigned in order of first use
+    uint id() const {return entry->id;}
+    /// Index of the original strand which is first in the canonical order
+    uint rotation() const {return shift;}
+
+    /// Hash of the lowest rotation of c and the number of strands c is rotated by to reach it,
+    /// computed without building the rotation; the hash is the same as hash() of a handle to c
+    static std::pair<std::size_t, uint> probe(Complex const &c);
+    /// Whether c, rotated by shift strands, is this complex
+    bool matches(Complex const &c, uint shift) const;
+
+    bool operator==(CanonicalComplex const &o) const {
+        return entry == o.entry || (hash() == o.hash() && complex() == o.complex());
+    }
+    bool operator<(CanonicalComplex const &o) const {return entry != o.entry && complex() < o.complex();}
+
+    auto save_repr() const {return complex().strands();}
+    void load_repr(StrandList const &s) {*this = CanonicalComplex(Complex(s));}
+
+    friend std::ostream & operator<<(std::ostream &os, CanonicalComplex const &c) {return os << c.complex();}
+};
+
+/******************************************************************************************/
+
+/**
+ * @brief Table interning CanonicalComplex handles for one owner, e.g. a ThermoEnviron
+ * It holds weak references, so an entry is freed with its last handle; expired references are
+ * dropped whenever the table has doubled in size since they were last dropped.
+ * Copying a table gives an empty one. Thread-safe.
+ */
+class ComplexTable {
+    struct Hash {std::size_t operator()(Complex const &c) const;}; // std::hash<Complex> is declared below
+
+    std::shared_mutex mutable mut;
+    std::unordered_map<Complex, std::weak_ptr<CanonicalComplex::Entry const>, Hash> map;
+    std::size_t pruned_size = 0;
+    uint count = 0;
+
+    void drop_expired(); // with the lock held
+
+public:
+    ComplexTable() = default;
+    ComplexTable(ComplexTable const &) : ComplexTable() {}
+    ComplexTable & operator=(ComplexTable const &) {return *this;}
+
+    /// Handle to c, sharing the entry of any live handle to a rotation of c from this table
+    CanonicalComplex intern(Complex const &c);
+
+    /// Number of complexes with live handles, plus any expired ones not yet dropped
+    std::size_t size() const;
+
+    /// Drop the references to entries which no handle uses any more
+    void prune();
+};
+
+/******************************************************************************************/
+
 SequenceList complex_to_loop(Complex const &c, int nick);
 
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "../reflect/Serialize.h"
 #include "Matrix.h"
+#include <fstream>
 
 namespace nupack {
 
@@ -1,5 +1,6 @@
 /** \file LRU.h
  * @brief Implementation of least-recently-used cache, with specialization for a memory limit
+ * and pluggable eviction policies
  */
 #pragma once
 
@@ -9,6 +10,9 @@
 
 #include "../standard/List.h"
 #include "../standard/Map.h"
+#include "../standard/Vec.h"
+
+#include <memory>
 
 namespace nupack {
 
@@ -22,11 +26,13 @@ struct MemoryLimit {
 
     constexpr MemoryLimit(length_type m=0) : capacity(m) {}
 
+    /// Size of an element, called once when it is inserted
     template <class T>
-    void add(T const &t) {length += memory::measure(t);}
+    static length_type measure(T const &t) {return memory::measure(t);}
 
-    template <class T>
-    void remove(T const &t) {length = unsigned_minus(length, memory::measure(t));}
+    void add(length_type n) {length += n;}
+
+    void remove(length_type n) {length = unsigned_minus(length, n);}
 
     bool ok() const {return length <= capacity;}
 
@@ -37,6 +43,106 @@ struct MemoryLimit {
 
 /******************************************************************************************/
 
+/// Memory limit whose total length is shared among several shards of a ShardedLRU
+struct SharedMemoryLimit {
+    using length_type = std::size_t;
+    std::shared_ptr<std::atomic<length_type>> total;
+    length_type length=0, capacity;
+
+    NUPACK_REFLECT(SharedMemoryLimit, length, capacity);
+
+    SharedMemoryLimit(length_type m=0) : SharedMemoryLimit(m, std::make_shared<std::atomic<length_type>>(0)) {}
+
+    SharedMemoryLimit(length_type m, std::shared_ptr<std::atomic<length_type>> t) : total(std::move(t)), capacity(m) {}
+
+    template <class T>
+    static length_type measure(T const &t) {return memory::measure(t);}
+
+    void add(length_type n) {length += n; *total += n;}
+
+    void remove(length_type n) {n = std::min(n, length); length -= n; *total -= n;}
+
+    /// The limit is satisfied if the summed length over all shards is within capacity
+    bool ok() const {return total->load(std::memory_order_relaxed) <= capacity;}
+
+    bool satisfiable() const {return capacity > 0;}
+
+    void clear() {remove(length);}
+};
+
+/******************************************************************************************/
+
+/// Time in seconds that it took to compute a value, used by cost-aware eviction policies
+struct RecomputeCost {
+    double seconds = 0;
+};
+
+/******************************************************************************************/
+
+/// Default eviction policy: the least recently used element is evicted first
+template <class Iterator>
+struct RecencyPolicy {
+    struct tag_type {};
+
+    tag_type insert(Iterator, std::size_t, double) {return {};}
+    void touch(tag_type &, Iterator, std::size_t, double) {}
+    void erase(tag_type const &) {}
+    void clear() {}
+
+    /// The element to evict next other than skip, or contents.end() if there is none
+    template <class List_>
+    Iterator victim(List_ &contents, Iterator skip) {
+        if (contents.empty()) return contents.end();
+        auto const last = std::prev(contents.end());
+        if (last != skip) return last;
+        return last == contents.begin() ? contents.end() : std::prev(last);
+    }
+};
+
+/******************************************************************************************/
+
+/**
+ * @brief GreedyDual-Size eviction policy: each element has priority H = I + cost / length,
+ * where I is the priority of the last evicted element. The element of lowest H is evicted, so
+ * elements which are cheap to recompute per byte freed go first, while I ages out elements
+ * which have not been used since.
+ * Elements of unknown cost (0) are evicted before any of known cost.
+ */
+template <class Iterator>
+struct GreedyDualSizePolicy {
+    using queue_type = std::multimap<double, Iterator>;
+    using tag_type = typename queue_type::iterator;
+
+    queue_type queue;
+    double inflation = 0;
+
+    static double ratio(std::size_t length, double cost) {return cost / std::max<std::size_t>(length, 1);}
+
+    tag_type insert(Iterator it, std::size_t length, double cost) {
+        return queue.emplace(inflation + ratio(length, cost), it);
+    }
+
+    void touch(tag_type &t, Iterator it, std::size_t length, double cost) {
+        queue.erase(t);
+        t = insert(it, length, cost);
+    }
+
+    void erase(tag_type const &t) {queue.erase(t);}
+
+    void clear() {queue.clear(); inflation = 0;}
+
+    template <class List_>
+    Iterator victim(List_ &contents, Iterator skip) {
+        for (auto const &[h, it] : queue) if (it != skip) {
+            inflation = h;
+            return it;
+        }
+        return contents.end();
+    }
+};
+
+/******************************************************************************************/
+
 /**
  * @brief Least-recently-used cache with partial thread-safety
  * @todo Improve the thread-safety and possibly performance of LRU()
@@ -47,9 +153,11 @@ struct MemoryLimit {
  * @tparam L=memory::measure Length operation functor
  * @tparam List_=List List template
  * @tparam Map_=Map Map template
+ * @tparam P=RecencyPolicy Eviction policy, chooses which element is evicted next
  */
-template <class K, class V, class L=MemoryLimit, template <class...> class List_=List, template <class...> class Map_=HashMap>
-struct LRU : Iterable<LRU<K, V, L, List_, Map_>> {
+template <class K, class V, class L=MemoryLimit, template <class...> class List_=List, template <class...> class Map_=HashMap,
+          template <class> class P=RecencyPolicy>
+struct LRU : Iterable<LRU<K, V, L, List_, Map_, P>> {
     using is_lru = True;
     using value_type = std::pair<K, V>;
     using limit_type = L;
@@ -58,8 +166,17 @@ struct LRU : Iterable<LRU<K, V, L, List_, Map_>> {
     using iterator = iterator_of<list_type>;
     using const_iterator = const_iterator_of<list_type>;
 
-    /// An atomic integer keeps track of any referrents to open Spot()s that haven't been filled
-    using map_type = Map_<K, iterator>;
+    using policy_type = P<iterator>;
+
+    /// Each key maps to its position in contents, the length it contributes to limit, and its eviction state
+    struct Slot {
+        using simple_type = True;
+        iterator position;
+        typename L::length_type length;
+        double cost;
+        typename policy_type::tag_type tag;
+    };
+    using map_type = Map_<K, Slot>;
     using key_type = K;
     using size_type = size_type_of<map_type>;
     using difference_type = difference_type_of<map_type>;
@@ -72,11 +189,12 @@ struct LRU : Iterable<LRU<K, V, L, List_, Map_>> {
     list_type contents;
     map_type map;
     L limit;
+    policy_type policy;
     SharedMutex mutable mut;
 
     LRU(L lim={}) : limit(std::move(lim)) {};
     LRU(LRU const &o) : contents(o.contents), limit(o.limit) {build_map();}
-    LRU(LRU &&o) : contents(std::move(o.contents)), map(std::move(o.map)), limit(std::move(o.limit)) {}
+    LRU(LRU &&o) : contents(std::move(o.contents)), map(std::move(o.map)), limit(std::move(o.limit)), policy(std::move(o.policy)) {}
     LRU & operator=(LRU o) {contents = std::move(o.contents); limit = std::move(o.limit); build_map(); return *this;}
 
     /**************************************************************************************/
@@ -84,28 +202,46 @@ struct LRU : Iterable<LRU<K, V, L, List_, Map_>> {
     auto read_lock() const {return shared_lock(mut);}
     auto write_lock() const {return unique_lock(mut);}
 
+    /// The LRU which holds a given key: for an unsharded LRU this is just itself
+    LRU & shard(key_type const &) {return *this;}
+    LRU const & shard(key_type const &) const {return *this;}
+
     auto key_comp() const {return map.key_comp();}
 
     /**
-     * @brief Try to erase the last non-referenced element in contents, then its associated element in map
+     * @brief Try to erase the element chosen by the eviction policy, then its associated element in map
      * @return true Element was erased
-     * @return false Element was not erased (no non-referenced elements in the container)
+     * @return false Element was not erased (no elements in the container)
      */
-    bool pop_back() {
-        if (contents.empty()) return false;
-        auto const m = map.find(contents.back().first);
+    bool pop_back() {return pop_back(std::end(contents));}
+
+    /// Same as pop_back() but never erasing the element at skip
+    bool pop_back(iterator skip) {
+        auto const v = policy.victim(contents, skip);
+        if (v == std::end(contents)) return false;
+        auto const m = map.find(v->first);
         NUPACK_DASSERT(m != std::end(map));
+        erase_list_iterator(m->second);
         map.erase(m);
-        erase_list_iterator(std::prev(contents.end()));
         return true;
     }
 
-    /// Try to erase least recently used element until length is under quota
+    /// Try to erase elements chosen by the eviction policy until length is under quota
     void shrink_to_fit() {while (!limit.ok() && pop_back()) {}}
 
+    /**
+     * @brief Same as shrink_to_fit() after inserting the element at kept
+     * If this LRU is within capacity on its own (possible only for a shard of a ShardedLRU),
+     * the excess belongs to other shards, so kept is not evicted to make room for it.
+     */
+    void shrink_to_fit(iterator kept) {
+        while (!limit.ok() && pop_back(limit.length > limit.capacity ? std::end(contents) : kept)) {}
+    }
+
     /// Empty all contents
     void clear() {
-        limit.clear();;
+        limit.clear();
+        policy.clear();
         map.clear();
         contents.clear();
     }
@@ -113,54 +249,60 @@ struct LRU : Iterable<LRU<K, V, L, List_, Map_>> {
     /// Not thread-safe
     void erase(key_type const &k) {
         auto const it = map.find(k);
-        if (it->second != contents.end())
+        if (it->second.position != contents.end())
             erase_list_iterator(it->second);
         map.erase(it);
     }
 
     template <class ...Ts>
-    bool try_emplace(key_type k, Ts &&...ts) {
-        auto map_it = map.emplace(k, std::end(contents)).first;
-        if (map_it->second == std::cend(contents)) {
-            prepend(std::move(k), static_cast<Ts &&>(ts)...);
-            map_it->second = std::begin(contents);
-            shrink_to_fit();
+    bool try_emplace(key_type k, Ts &&...ts) {return try_emplace(RecomputeCost(), std::move(k), static_cast<Ts &&>(ts)...);}
+
+    /// Same as try_emplace() but recording the cost of computing the value
+    template <class ...Ts>
+    bool try_emplace(RecomputeCost c, key_type k, Ts &&...ts) {
+        auto map_it = map.emplace(k, Slot{std::end(contents), 0, 0, {}}).first;
+        if (map_it->second.position == std::cend(contents)) {
+            map_it->second = prepend(c, std::move(k), static_cast<Ts &&>(ts)...);
+            shrink_to_fit(map_it->second.position);
             return true;
         }
-        if (std::begin(contents) != map_it->second)
-            contents.splice(std::begin(contents), contents, map_it->second);
+        refresh(map_it->second);
         return false;
     }
 
     template <class ...Ts>
-    bool insert_or_assign(key_type k, Ts &&...ts) {
-        auto map_it = map.emplace(k, std::end(contents)).first;
+    bool insert_or_assign(key_type k, Ts &&...ts) {return insert_or_assign(RecomputeCost(), std::move(k), static_cast<Ts &&>(ts)...);}
+
+    /// Same as insert_or_assign() but recording the cost of computing the value
+    template <class ...Ts>
+    bool insert_or_assign(RecomputeCost c, key_type k, Ts &&...ts) {
+        auto map_it = map.emplace(k, Slot{std::end(contents), 0, 0, {}}).first;
         bool inserted = false;
-        prepend(std::move(k), static_cast<Ts &&>(ts)...);
-        if (map_it->second == std::cend(contents)) inserted = true;
+        auto slot = prepend(c, std::move(k), static_cast<Ts &&>(ts)...);
+        if (map_it->second.position == std::cend(contents)) inserted = true;
         else erase_list_iterator(map_it->second);
-        map_it->second = std::begin(contents);
-        shrink_to_fit();
+        map_it->second = slot;
+        shrink_to_fit(slot.position);
         return inserted;
     }
 
     /// Equivalent to std::map::find but moves the found element at the front of the cache (not thread-safe)
     iterator find_and_refresh(key_type const &k) {
         if (auto it = map.find(k); it != std::end(map)) {
-            contents.splice(begin_of(contents), contents, it->second);
-            return it->second;
+            refresh(it->second);
+            return it->second.position;
         } else return std::end(contents);
     }
 
     /// Equivalent to std::map::find (thread-safe if LRU not being modified)
     const_iterator find(key_type const &k) const {
-        if (auto it = map.find(k); it != std::end(map)) return it->second;
+        if (auto it = map.find(k); it != std::end(map)) return it->second.position;
         else return std::end(contents);
     }
 
     /// Equivalent to std::map::find (thread-safe if LRU not being modified)
     iterator find(key_type const &k) {
-        if (auto it = map.find(k); it != std::end(map)) return it->second;
+        if (auto it = map.find(k); it != std::end(map)) return it->second.position;
         else return std::end(contents);
     }
 
@@ -177,23 +319,40 @@ struct LRU : Iterable<LRU<K, V, L, List_, Map_>> {
 
 protected:
     /// Build map from existing contents (not generally for public consumption)
+    /// Recompute costs are not kept, so rebuilt elements are treated as having unknown cost
     void build_map() {
+        limit.clear();
+        policy.clear();
+        map.clear();
         for (auto i : iterators(contents)) {
-            map.emplace(i->first, i);
-            limit.add(*i);
+            auto const n = limit.measure(*i);
+            map.emplace(i->first, Slot{i, n, 0, policy.insert(i, n, 0)});
+            limit.add(n);
         }
     }
 
+    /// Insert an element at the front, measuring its length only this once
     template <class ...Ts>
-    void prepend(key_type &&k, Ts &&...ts) {
+    Slot prepend(RecomputeCost c, key_type &&k, Ts &&...ts) {
         contents.emplace_front(std::move(k), mapped_type{static_cast<Ts &&>(ts)...});
-        limit.add(contents.front());
+        auto const it = std::begin(contents);
+        auto const n = limit.measure(*it);
+        limit.add(n);
+        return {it, n, c.seconds, policy.insert(it, n, c.seconds)};
+    }
+
+    /// Mark an element as just used
+    void refresh(Slot &s) {
+        if (std::begin(contents) != s.position)
+            contents.splice(std::begin(contents), contents, s.position);
+        policy.touch(s.tag, s.position, s.length, s.cost);
     }
 
     /// Erase element in contents and decrement the length counter
-    void erase_list_iterator(iterator it) {
-        limit.remove(*it);
-        contents.erase(it);
+    void erase_list_iterator(Slot const &s) {
+        limit.remove(s.length);
+        policy.erase(s.tag);
+        contents.erase(s.position);
     }
 };
 
@@ -201,4 +360,84 @@ NUPACK_DETECT(is_lru, void_if<T::is_lru::value>);
 
 /******************************************************************************************/
 
+/**
+ * @brief LRU split into independently locked shards, chosen by key hash
+ * Each shard evicts its own least recently used elements while the summed length over all
+ * shards exceeds the shared capacity, except for the element it has just inserted: so the
+ * total may exceed the capacity by up to one element per shard until those shards next insert.
+ * @tparam S Number of shards
+ */
+template <class K, class V, std::size_t S=16, template <class...> class List_=List, template <class...> class Map_=HashMap,
+          template <class> class P=RecencyPolicy>
+struct ShardedLRU {
+    using is_lru = False;
+    using shard_type = LRU<K, V, SharedMemoryLimit, List_, Map_, P>;
+    using limit_type = SharedMemoryLimit;
+    using value_type = typename shard_type::value_type;
+    using mapped_type = V;
+    using key_type = K;
+    using length_type = typename limit_type::length_type;
+
+    vec<shard_type> shards;
+
+    ShardedLRU(length_type capacity=0) {
+        auto total = std::make_shared<std::atomic<length_type>>(0);
+        shards.reserve(S);
+        for (std::size_t i = 0; i != S; ++i) shards.emplace_back(limit_type(capacity, total));
+    }
+
+    /// Copy the contents of each shard under a new shared total (recompute costs are not kept)
+    ShardedLRU(ShardedLRU const &o) : ShardedLRU(o.capacity()) {
+        for (std::size_t i = 0; i != S; ++i) {
+            auto lk = o.shards[i].read_lock();
+            for (auto it = o.shards[i].contents.rbegin(); it != o.shards[i].contents.rend(); ++it)
+                shards[i].try_emplace(it->first, it->second);
+        }
+    }
+
+    ShardedLRU(ShardedLRU &&) = default;
+    ShardedLRU & operator=(ShardedLRU o) {shards = std::move(o.shards); return *this;}
+
+    /// The shard which holds a given key (the hash is remixed since the shard maps use it too)
+    shard_type & shard(key_type const &k) {return shards[shard_index(k)];}
+    shard_type const & shard(key_type const &k) const {return shards[shard_index(k)];}
+
+    /// Summed length of all shards
+    length_type length() const {return shards.empty() ? 0 : shards[0].limit.total->load();}
+
+    length_type capacity() const {return shards.empty() ? 0 : shards[0].limit.capacity;}
+
+    std::size_t size() const {return sum(shards, [](auto const &s) {return len(s.contents);});}
+
+    /// Empty all shards (thread-safe)
+    void clear() {for (auto &s : shards) {auto lk = s.write_lock(); s.clear();}}
+
+    /// Equivalent to LRU::insert_or_assign on the relevant shard (thread-safe)
+    template <class ...Ts>
+    bool insert_or_assign(key_type k, Ts &&...ts) {
+        auto &s = shard(k);
+        auto lk = s.write_lock();
+        return s.insert_or_assign(std::move(k), static_cast<Ts &&>(ts)...);
+    }
+
+    /// Call a function with the stored value for a key, if present, under a read lock (thread-safe)
+    template <class F>
+    bool visit(key_type const &k, F &&f) const {
+        auto const &s = shard(k);
+        auto lk = s.read_lock();
+        auto it = s.find(k);
+        if (it == std::end(s.contents)) return false;
+        f(it->second);
+        return true;
+    }
+
+protected:
+    std::size_t shard_index(key_type const &k) const {
+        auto const h = hash<K>()(k);
+        return (h ^ (h >> 17) ^ (h >> 31)) % S;
+    }
+};
+
+/******************************************************************************************/
+
 }
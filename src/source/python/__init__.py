@@ -12,7 +12,7 @@ __version__ = info.version
 ################################################################################
 
 from .model import Model, ParameterFile, Conditions, Ensemble, \
-    structure_energy, loop_energy
+    structure_energy, structure_energies, loop_energy, first_passage_times
 
 from .core import PairList, Local, Sequence, Base, Structure, JSON, Domain, \
     RawStrand, RawComplex, TargetComplex, TargetStrand, PairsMatrix, struc_distance, \
@@ -24,7 +24,8 @@ from .named import Strand, Complex, Result as AnalysisResult, tube_analysis, \
     Tube, complex_analysis, complex_concentrations, ComplexSet, SetSpec
 
 from .analysis import ConcentrationSolver, ComplexResult, \
-    energy, structure_probability, ensemble_size, pfunc, mfe, pairs, subopt, sample
+    energy, structure_probability, ensemble_size, pfunc, mfe, pairs, subopt, sample, \
+    ensemble_energies, pfunc_gradient, pfunc_gradients
 
 from .design import TargetTube, complex_design, tube_design, \
     Match, Pattern, SSM, Library, Diversity, Similarity, Complementarity, \
@@ -74,6 +75,7 @@ def render():
 rendered_document, config = render()
 config.parallelism = False
 config.cache = 2.0
+config.cache_directory = None # optional directory of persistent dynamic program records
 
 constants.TypeIndex = rendered_document['TypeIndex']
 constants.set_default_parameters_path(os.path.join(os.path.dirname(__file__), 'parameters'))
@@ -59,6 +59,44 @@ def pfunc(strands, model) -> Tuple[float, float]:
 
 ################################################################################
 
+def ensemble_energies(strands, model) -> Tuple[float, float, float]:
+    '''
+    Calculate ensemble free energy, enthalpy and entropy of a single complex
+    from one dynamic program that also differentiates with respect to temperature
+    - model(Model): free energy model to use
+    - Returns a tuple of (free_energy, enthalpy, entropy) in kcal/mol, kcal/mol and kcal/mol/K
+    '''
+    strands = RawComplex(strands)
+    return thermo.ensemble_energies(core.Local(), strands, model)
+
+################################################################################
+
+def pfunc_gradient(strands, model) -> Tuple[float, numpy.ndarray]:
+    '''
+    Calculate log partition function of a single complex and its exact gradient
+    with respect to each entry of the model's parameter array
+    - model(Model): free energy model to use
+    - Returns a tuple of (log partition function, gradient array)
+    '''
+    strands = RawComplex(strands)
+    logq, grad = thermo.log_pfunc_gradient(core.Local(), strands, model)
+    return logq, numpy.asarray(grad)
+
+def pfunc_gradients(records, ensemble='stacking') -> Dict[str, Tuple[float, numpy.ndarray]]:
+    '''
+    Calculate log partition functions and their exact parameter gradients for a set of complexes,
+    each under its own conditions, as for fitting parameters to a partition function database
+    - records(dict): for each '+'-separated strand string, a dict with the reference log partition
+      function 'result', 'material', temperature 'T' in Celsius, 'sodium' and 'magnesium'
+    - ensemble: the ensemble used for every record
+    - Returns a dict from each key to (log partition function, gradient array)
+    '''
+    database = core.JSON.from_object(dict(modified='', revision='', data=records))
+    out = thermo.pfunc_gradients(core.Local(), database, Ensemble.get(ensemble))
+    return {k: (logq, numpy.asarray(grad)) for k, (logq, grad) in out.items()}
+
+################################################################################
+
 def pairs(strands, model, *, sparsity_fraction=1, sparsity_threshold=0) -> PairsMatrix:
     '''
     Calculate equilibrium pair probabilities of a single complex
@@ -334,12 +372,13 @@ class Specification:
         kw = dict(env=env, pairing=thermo.obs(pairing), observe=None, gil=gil)
         out = {k: {} for k in self.tasks}
 
+        disk = config.cache_directory
         thermo.compute_pf(self.tasks, out, **kw,
-            **thermo.options('pf', mem, self.model, bits['pfunc']))
+            **thermo.options('pf', mem, self.model, bits['pfunc'], directory=disk))
         thermo.compute_mfe(self.tasks, out, **kw,
-            **thermo.options('mfe', mem, self.model, bits['mfe']))
+            **thermo.options('mfe', mem, self.model, bits['mfe'], directory=disk))
         thermo.compute_count(self.tasks, out, **kw,
-            **thermo.options('pf', mem, self.model, bits['count'], count=True))
+            **thermo.options('pf', mem, self.model, bits['count'], count=True, directory=disk))
 
         return {k: ComplexResult(self.model, **v) for k, v in out.items()} # maybe return caches too if requested
 
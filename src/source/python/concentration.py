@@ -1,6 +1,7 @@
 import numpy as np
 from . import constants
 from .rebind import forward
+from .core import Local
 
 ################################################################################
 
@@ -83,7 +84,29 @@ def solve(A, logb, logq, options=None, strict=True, _fun_=None):
 ################################################################################
 
 @forward
-def solve_complexes(indices, logq, x0, options, rotational_correction=True, as_strands=True) -> Output:
+def solve_batch(A, logb, logq, options=None, *, threads=None, strict=True, _fun_=None):
+    '''
+    Solve equilibrium concentrations for many strand concentrations with the same complexes,
+    e.g. a titration series. Each point is warm-started from the previous one.
+
+    - `A` (ndarray): reaction coefficient matrix (n_complexes, n_strands)
+    - `logb` (ndarray): log of initial strand concentrations (n_points, n_strands)
+    - `logq` (ndarray): logarithms of partition functions (n_complexes)
+    - `options`: (Options) solving options
+    - `threads` (int): number of threads to use (default: config.parallelism)
+    - Returns a list of Output, one per point
+    '''
+    A, logb, logq = [np.asarray(o, dtype=np.float64) for o in (A, logb, logq)]
+    options = Options() if options is None else options
+    out = _fun_(Local(threads), np.asfortranarray(A), np.asfortranarray(logb.T), logq, options)
+    if strict:
+        assert all(o.converged for o in out), 'Solver did not converge'
+    return out
+
+################################################################################
+
+@forward
+def solve_complexes(env, indices, logq, x0, options, rotational_correction=True, as_strands=True) -> Output:
     '''
     Solve equilibrium concentrations (non-dimensionalized)
     Users should generally use `complex_concentrations`.
@@ -93,7 +116,7 @@ def solve_complexes(indices, logq, x0, options, rotational_correction=True, as_s
 
 @forward
 def solve_complex_concentrations(indices, logq, x0, kelvin, *,
-    rotational_correction=True, as_strands=True, strict=True, **kws):
+    rotational_correction=True, as_strands=True, strict=True, threads=None, **kws):
     '''
     Solve equilibrium concentrations for a set of specified complexes
 
@@ -105,10 +128,11 @@ def solve_complex_concentrations(indices, logq, x0, kelvin, *,
         initial concentrations for each complex
       `rotational_correction`: True if rotational correction needs to be applied here
     - `kelvin` (float): temperature in Kelvin
+    - `threads` (int): number of threads used to build the solver's Hessian (default: config.parallelism)
     '''
     logq = np.asarray(logq, dtype=np.float64)
     x0 = np.asarray(x0, dtype=np.float64) / constants.water_molarity(kelvin)
-    out = solve_complexes(indices, logq, x0, Options(**kws),
+    out = solve_complexes(Local(threads), indices, logq, x0, Options(**kws),
         rotational_correction=rotational_correction, as_strands=as_strands)
     if strict:
         assert out.converged, 'Solver did not converge'
@@ -2,8 +2,8 @@ import enum, numpy
 
 from .utility import nbits, match, check_instance
 from .constants import as_sequences
-from .core import PairList, JSON, Pickleable, RawComplex
-from .rebind import forward, Dict
+from .core import PairList, JSON, Pickleable, RawComplex, Local
+from .rebind import forward, Dict, List, Tuple
 
 ################################################################################
 
@@ -46,8 +46,27 @@ class ParameterFile:
         Initialize from parameter set name or file name
         - 'rna'/'RNA' is translated to 'rna06'
         - 'dna'/'DNA' is translated to 'dna04'
+        - names ending in '.bin' refer to precompiled binary parameter files
         '''
 
+    def resolve(self) -> str:
+        '''Full path of the parameter file that will be loaded'''
+
+    def compile(self, out: str):
+        '''
+        Write the parameters to a binary file which loads without parsing JSON
+        - if `out` is next to the JSON file with the same name and a '.bin' suffix,
+        it is used automatically in place of the JSON file while it is not older
+        '''
+
+@forward
+def clear_parameter_registry(_fun_=None):
+    '''
+    Release the parameter tables kept for the most recently used parameter files
+    - models which are still alive keep their own tables
+    '''
+    _fun_()
+
 ################################################################################
 
 @forward
@@ -173,6 +192,22 @@ class Model(Pickleable):
         '''Temperature in Kelvin'''
         return self.conditions.temperature
 
+    def fingerprint(self) -> str:
+        '''Stable 128-bit hexadecimal digest identifying the model's parameters, conditions, and ensemble'''
+
+    def __hash__(self):
+        return hash(self.fingerprint())
+
+    def parameter(self, index) -> float:
+        '''Return an entry of the parameter array, as differentiated by pfunc_gradient()'''
+
+    def with_parameter(self, index, value):
+        '''Return a copy of the model with one entry of the parameter array replaced'''
+
+    def with_ensemble(self, ensemble, _fun_=None):
+        '''Return a copy of the model in a different ensemble'''
+        return _fun_(self, Ensemble.get(ensemble))
+
     def boltz(self, energy) -> float:
         '''Return the Boltzmann factor corresponding to a given free energy (kcal/mol)'''
 
@@ -235,6 +270,37 @@ def structure_energy(strands, structure, model, distinguishable=False, _fun_=Non
     check_instance(model, Model)
     return _fun_(strands, structure, model, distinguishable).cast(float)
 
+def structure_energies(structures, model, *, distinguishable=False, threads=None, _fun_=None):
+    '''
+    Free energies (kcal/mol) of many secondary structures, evaluated in parallel
+    - structures: iterable of (strands, structure) pairs
+    - threads(int): number of threads to use (default: config.parallelism)
+    '''
+    check_instance(model, Model)
+    items = [(as_sequences(s), PairList(p)) for s, p in structures]
+    return _fun_(Local(threads), items, model, distinguishable).cast(numpy.ndarray)
+
+def first_passage_times(strands, start, targets, model, *, trajectories=1, max_time=1.0, max_steps=0,
+                        unimolecular=6.1e7, bimolecular=1.26e6, molarity=1e-6, seed=0, threads=None, _fun_=None):
+    '''
+    Simulate secondary structure kinetics with elementary base pair steps (Gillespie algorithm)
+    - strands: strand sequences
+    - start: initial structure
+    - targets: list of (structure, distance) stop conditions, where distance is the allowed
+      number of differing pair list entries
+    - max_time(float): simulated time (s) after which a trajectory stops regardless
+    - max_steps(int): maximum number of steps per trajectory, or 0 for no limit
+    - unimolecular, bimolecular(float): Kawasaki rate prefactors (1/s and 1/M/s)
+    - molarity(float): strand concentration (M) setting the association rate
+    - seed(int): if nonzero, seed the random generator first so that the trajectories are reproducible
+    - Returns a list of (time, steps, index of target reached or -1, final structure, final energy)
+    '''
+    check_instance(model, Model)
+    targets = [(PairList(t), int(d)) for t, d in targets]
+    out = _fun_(Local(threads), as_sequences(strands), PairList(start), model, targets, int(trajectories),
+                float(max_time), int(max_steps), float(unimolecular), float(bimolecular), float(molarity), int(seed))
+    return out.cast(List[Tuple[float, int, int, PairList, float]])
+
 ################################################################################
 
 def loop_energy(sequences, *, structure=None, model):
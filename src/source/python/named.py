@@ -1,5 +1,6 @@
 from .core import RawStrand, RawComplex, Pickleable, Sparsity, PairsMatrix, MaterialContext
 from .constants import complexes_from_max_size
+from . import rotation
 from .utility import create_name, check_instances, from_argument, BaseResult, printable, Loadable, long_output
 from .analysis import Specification, ConcentrationSolver, ensemble_pair_fractions
 from typing import Tuple, NamedTuple
@@ -398,6 +399,58 @@ def tube_analysis(tubes, model, *, compute=(), **kws):
 
 ################################################################################
 
+def heuristic_tube_analysis(strands, model, *, max_size, threshold=1e-12, name='tube', compute=(), **kws):
+    '''
+    Heuristic tube analysis which enumerates complexes by increasing size rather than all up front.
+    Unlike tube_analysis(), it may leave out complexes whose equilibrium concentration is not
+    negligible, so it is only suitable when that risk is acceptable.
+    - strands: a dict of Strand to concentration (M)
+    - max_size: maximum number of strands in a complex
+    - threshold: concentration (M) below which a complex is not extended to larger complexes
+    - compute, kws: as in tube_analysis()
+
+    After each size, the equilibrium is solved with the complexes found so far. Adding complexes
+    can only lower the dual solution y (the free strand potentials), so the current concentration
+    exp(A y + log q) of a complex bounds its concentration in any larger ensemble. That bound only
+    covers complexes which have been analyzed: nothing bounds log q of a complex which has not, so
+    complexes of the next size are generated only by inserting one strand into a complex whose
+    bound reaches the threshold, on the unproven assumption that extensions of a negligible
+    complex are negligible too. With threshold=0 every complex up to max_size is analyzed and the
+    result is exact.
+    Returns a Result with the analyzed complexes and a single tube containing them.
+    Not exported from the nupack package until unanalyzed extensions have a real bound on log q.
+    '''
+    if max_size < 1:
+        raise ValueError('max_size should be at least 1')
+    strands, conc = zip(*dict(strands).items())
+    strands = check_instances(strands, Strand)
+    compute = ['pfunc'] + list(compute)
+
+    result = Result()
+    frontier = {Complex([s]) for s in strands}
+    for size in range(1, max_size + 1):
+        result.complexes.update(complex_analysis(frontier, compute=compute, model=model, **kws).complexes)
+        solver = ConcentrationSolver(strands, result.complexes, distinguishable=False)
+        bound = solver.compute(conc).complex_concentrations
+
+        frontier = set()
+        for c in result.complexes if size < max_size else ():
+            if len(c.strands) != size or bound[c] < threshold:
+                continue
+            for s in strands:
+                for i in range(size):
+                    new = Complex(rotation.lowest_rotation(list(c.strands[:i]) + [s] + list(c.strands[i:])))
+                    if new not in result.complexes:
+                        frontier.add(new)
+        if not frontier:
+            break
+
+    tube = Tube(zip(strands, conc), complexes=list(result.complexes), name=name)
+    result.tubes[tube] = TubeResult(bound, tube=tube, result=result)
+    return result
+
+################################################################################
+
 def complex_concentrations(tube, data, concentrations=None):
     '''Calculate the equilibrium concentrations for a given tube using already calculated complex results'''
     if concentrations is None:
@@ -49,15 +49,85 @@ class CachedModel:
 
 ################################################################################
 
+def _cache_type(obj, ensemble, complexity, types):
+    ensemble = Ensemble.get(ensemble)
+    if ensemble == Ensemble.none_nupack3: # uses same recursions as nostacking
+        ensemble = Ensemble.nostacking
+    key = (int(complexity), int(ensemble), *types)
+    return match(k for k, v in obj._metadata_.items() if v.cast(object) == key)
+
+def _cache_args(nbytes, compress, directory, model):
+    if directory is None:
+        return (int(nbytes), bool(compress))
+    assert model is not None, 'A model is needed to key the records saved in a cache directory'
+    return (int(nbytes), bool(compress), str(directory), model.fingerprint())
+
 @forward
 class Cache(LRU):
-    def __init__(self, nbytes, ensemble, complexity=3, types=(64,), _fun_=None):
-        ensemble = Ensemble.get(ensemble)
-        if ensemble == Ensemble.none_nupack3: # uses same recursions as nostacking
-            ensemble = Ensemble.nostacking
-        key = (int(complexity), int(ensemble), *types)
-        _fun_(self, int(nbytes), return_type=match(
-            k for k, v in self._metadata_.items() if v.cast(object) == key))
+    '''
+    Memory-limited cache of dynamic program records
+    - directory: optional directory of a persistent disk tier, shared between processes.
+      Its records are keyed by the fingerprint of model, which must be the model the
+      records are computed with (e.g. CachedModel.energy_model)
+    - compress: hold records losslessly compressed, so that more fit in nbytes
+    '''
+    def __init__(self, nbytes, ensemble, complexity=3, types=(64,), directory=None, model=None, compress=False, _fun_=None):
+        _fun_(self, *_cache_args(nbytes, compress, directory, model),
+            return_type=_cache_type(self, ensemble, complexity, types))
+
+    def directory(self) -> str:
+        '''Return the directory of the disk tier, or an empty string if there is none'''
+
+    def compressed(self) -> bool:
+        '''Return whether records are held compressed'''
+
+    def contains(self, strands) -> bool:
+        '''Return whether a record for the given complex is held'''
+
+################################################################################
+
+@forward
+class CostAwareCache(LRU):
+    '''
+    Same as Cache, but evicting the records which are cheapest to recompute per byte
+    first (GreedyDual-Size) rather than the least recently used (accepted by dynamic_program only)
+    '''
+    def __init__(self, nbytes, ensemble, complexity=3, types=(64,), directory=None, model=None, compress=False, _fun_=None):
+        _fun_(self, *_cache_args(nbytes, compress, directory, model),
+            return_type=_cache_type(self, ensemble, complexity, types))
+
+    def contains(self, strands) -> bool:
+        '''Return whether a record for the given complex is held'''
+
+################################################################################
+
+@forward
+class ShardedCache:
+    '''
+    Cache split into independently locked shards under one memory limit, so that
+    concurrent dynamic programs contend less on it (accepted by dynamic_program only)
+    '''
+    def __init__(self, nbytes, ensemble, complexity=3, types=(64,), directory=None, model=None, compress=False, _fun_=None):
+        _fun_(self, *_cache_args(nbytes, compress, directory, model),
+            return_type=_cache_type(self, ensemble, complexity, types))
+
+    def directory(self) -> str:
+        '''Return the directory of the disk tier, or an empty string if there is none'''
+
+    def compressed(self) -> bool:
+        '''Return whether records are held compressed'''
+
+    def length(self) -> int:
+        '''Return the summed memory of all shards in bytes'''
+
+    def capacity(self) -> int:
+        '''Return the memory limit in bytes'''
+
+    def size(self) -> int:
+        '''Return the number of records held'''
+
+    def contains(self, strands) -> bool:
+        '''Return whether a record for the given complex is held'''
 
 ################################################################################
 
@@ -69,8 +139,20 @@ class XTensor:
 
 @forward
 class PairingAction:
-    def __init__(self, function=None, _fun_=None):
-        _fun_(self) if function is None else _fun_(self, function)
+    def __init__(self, allowed=None, _fun_=None):
+        '''
+        Restrict the pairs considered by the QB recursion
+        - allowed: None to permit every pair, or a square boolean matrix over the bases of the
+          complex whose (i, j) or (j, i) entry is set if bases i and j may pair
+        '''
+        if allowed is None:
+            _fun_(self)
+            return
+        allowed = numpy.asarray(allowed, dtype=bool)
+        if allowed.ndim != 2 or allowed.shape[0] != allowed.shape[1]:
+            raise ValueError('allowed pairs should be given as a square matrix')
+        i, j = numpy.nonzero(numpy.triu(allowed | allowed.T))
+        _fun_(self, len(allowed), list(zip(i.tolist(), j.tolist())))
 
 ################################################################################
 
@@ -119,6 +201,107 @@ def pair_probability(env, strands, models, cache, observe: Callable[[Message], N
 def permutations(env, max_size, strands, models, cache, observe: Callable[[Message], None], pairing) -> List[Tuple[RawComplex, float]]:
     '''Low-level dynamic program call expecting all arguments to be specified'''
 
+@forward
+def ensemble_energies(env, strands, model) -> Tuple[float, float, float]:
+    '''Low-level call for the ensemble free energy, enthalpy and entropy of a complex'''
+
+@forward
+def log_pfunc_gradient(env, strands, model) -> Tuple[float, List[float]]:
+    '''Low-level call for log Q of a complex and its exact gradient with respect to the model parameters'''
+
+@forward
+def pfunc_gradients(env, database, ensemble) -> Dict[str, Tuple[float, List[float]]]:
+    '''Low-level call for log Q and its gradient for every record of a JSON partition function database'''
+
+@forward
+def submit_dynamic_program(executor, strands, models, cache, limits):
+    '''Low-level call starting a dynamic program in the background, expecting all arguments to be specified'''
+
+################################################################################
+
+@forward
+class JobLimits:
+    '''Resource limits of a background job, where 0 means no limit'''
+    seconds: float
+    bytes: int
+
+    def __init__(self, seconds=0, bytes=0, _fun_=None):
+        '''
+        - seconds: wall time allowed from submission
+        - bytes: memory of the dynamic program blocks held at once
+        '''
+        _fun_(self)
+        self.seconds = float(seconds)
+        self.bytes = int(bytes)
+
+class JobInterrupted(RuntimeError):
+    '''Raised by Job.get() for a job which was cancelled or exceeded one of its limits'''
+    def __init__(self, reason):
+        super().__init__('job stopped: {}'.format(reason))
+        self.reason = reason
+
+@forward
+class Job:
+    '''Handle to a thermo computation running in the background'''
+    STOPPED = ('none', 'cancelled', 'timeout', 'memory')
+
+    def progress(self) -> float:
+        '''Return the estimated fraction of the job done, counting only finished blocks'''
+
+    def ready(self) -> bool:
+        '''Return whether the result (or the exception) is available'''
+
+    def wait(self, seconds) -> bool:
+        '''Wait up to the given number of seconds and return whether the job is ready'''
+
+    def cancel(self) -> None:
+        '''Ask the job to stop; get() then raises JobInterrupted'''
+
+    def pause(self) -> None:
+        '''Hold the job at its next check (within a few DP diagonals) until resume(), cancel(), or its time limit'''
+
+    def resume(self) -> None:
+        '''Let a paused job continue'''
+
+    def memory(self) -> int:
+        '''Return the bytes of dynamic program blocks currently charged to the job'''
+
+    def stopped(self, _fun_=None) -> str:
+        '''Return why the job was stopped: none, cancelled, timeout, or memory'''
+        return self.STOPPED[_fun_(self).cast(int)]
+
+    def get(self, _fun_=None) -> float:
+        '''Wait for the job and return its result, raising any error it raised (JobInterrupted if it was stopped)'''
+        try:
+            return _fun_(self).cast(float)
+        except RuntimeError:
+            if self.stopped() == 'none':
+                raise
+            raise JobInterrupted(self.stopped())
+
+@forward
+class JobExecutor:
+    '''Runs thermo jobs in the background, all sharing one parallel executor'''
+    def __init__(self, env=None, _fun_=None):
+        _fun_(self, env if isinstance(env, Local) else Local(env))
+
+    def n_workers(self) -> int:
+        '''Return the number of workers shared by the jobs'''
+
+    def submit(self, strands, model=None, cache=0, seconds=0, bytes=0, kind='pf', paused=False):
+        '''
+        Start computing the log partition function (or MFE) of a complex and return its Job
+        - strands: list of strand sequences
+        - model: a Model or CachedModel
+        - cache: bytes of cache private to the job (0 for none)
+        - seconds, bytes: limits of the job (0 for no limit)
+        - paused: if True, the job does no work until Job.resume()
+        '''
+        if not isinstance(model, CachedModel):
+            model = CachedModel(Model() if model is None else model, kind=kind)
+        return submit_dynamic_program(self, RawComplex(strands), [model],
+            float(cache), JobLimits(seconds, bytes), bool(paused))
+
 ################################################################################
 
 
@@ -130,15 +313,16 @@ def _call(fun, strands, **kws):
 
 ################################################################################
 
-def options(kind, mem, model, bits, ensemble=None, count=False):
+def options(kind, mem, model, bits, ensemble=None, count=False, directory=None):
     if ensemble is not None:
-        model = model.copy()
-        model.ensemble = ensemble
+        model = model.with_ensemble(ensemble)
     models = [CachedModel(model=model, kind=kind, bits=abs(b)) for b in bits]
     if count:
         for m in models:
             m.set_beta(0)
-    return dict(cache=Cache(mem, model.ensemble, 3, bits) if mem else False, models=models)
+    cache = Cache(mem, model.ensemble, 3, bits, directory=directory,
+        model=models[0].energy_model) if mem else False
+    return dict(cache=cache, models=models)
 
 ################################################################################
 
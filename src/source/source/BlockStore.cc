@@ -0,0 +1,146 @@
+/**
+ * @brief Definitions for the on-disk block record store
+ *
+ * @file BlockStore.cc
+ */
+#include <nupack/thermo/BlockStore.h>
+#include <nupack/reflect/Hash.h>
+#include <nupack/reflect/Print.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <atomic>
+#include <random>
+
+#if __has_include(<sys/mman.h>)
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#   define NUPACK_HAS_MMAP
+#endif
+
+namespace nupack::thermo {
+
+namespace {
+    constexpr std::string_view Magic = "NUPACK-BLOCK-1\n";
+
+    /// Suffix of a temporary file unique to this write: process id, a random process salt and a counter
+    std::string temporary_suffix() {
+        static std::uint32_t const salt = std::random_device()();
+        static std::atomic<std::uint64_t> count{0};
+        std::ostringstream ss;
+#ifdef NUPACK_HAS_MMAP
+        ss << ::getpid() << '.';
+#endif
+        ss << std::hex << salt << '.' << count++ << ".tmp";
+        return ss.str();
+    }
+}
+
+/******************************************************************************************/
+
+MappedFile::MappedFile(std::string const &path) {
+#ifdef NUPACK_HAS_MMAP
+    int const fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct ::stat st;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+        void *p = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {address = p; length = st.st_size;}
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return;
+    std::ostringstream ss;
+    ss << file.rdbuf();
+    fallback = std::move(ss).str();
+    length = fallback.size();
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef NUPACK_HAS_MMAP
+    if (address) ::munmap(address, length);
+#endif
+}
+
+std::string_view MappedFile::contents() const {
+    if (address) return {static_cast<char const *>(address), length};
+    return fallback;
+}
+
+/******************************************************************************************/
+
+BlockStore::BlockStore(std::string dir, std::string f) : directory(std::move(dir)), fingerprint(std::move(f)) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) NUPACK_ERROR("could not create block store directory", directory, ec.message());
+}
+
+std::string BlockStore::key(Complex const &seq, std::string_view tag) const {
+    std::string out = fingerprint;
+    out += '|';
+    out += tag;
+    out += '|';
+    out += delimited_string(seq.views(), "+");
+    return out;
+}
+
+std::string BlockStore::path(std::string const &key) const {
+    std::ostringstream ss;
+    ss << std::hex << std::hash<std::string>()(key) << ".blk";
+    return (std::filesystem::path(directory) / ss.str()).string();
+}
+
+void BlockStore::write(std::string const &key, std::string const &payload) const {
+    auto const p = path(key);
+    std::ostringstream tmp;
+    tmp << p << '.' << temporary_suffix();
+    {
+        std::ofstream file(tmp.str(), std::ios::binary | std::ios::trunc);
+        if (!file) return; // the disk tier is best-effort
+        std::uint64_t const n = key.size(), m = payload.size();
+        file.write(Magic.data(), Magic.size());
+        file.write(reinterpret_cast<char const *>(&n), sizeof(n));
+        file.write(key.data(), n);
+        file.write(reinterpret_cast<char const *>(&m), sizeof(m));
+        file.write(payload.data(), m);
+        if (!file) {std::remove(tmp.str().c_str()); return;}
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp.str(), p, ec);
+    if (ec) std::remove(tmp.str().c_str());
+}
+
+/// Return the payload if the file has a valid header for the given key
+Optional<std::string_view> BlockStore::read(MappedFile const &file, std::string const &key) const {
+    if (!file) return {};
+    auto s = file.contents();
+    auto take = [&](std::size_t n) -> Optional<std::string_view> {
+        if (s.size() < n) return {};
+        auto out = s.substr(0, n);
+        s.remove_prefix(n);
+        return out;
+    };
+    auto take_size = [&]() -> Optional<std::uint64_t> {
+        std::uint64_t n;
+        auto b = take(sizeof(n));
+        if (!b) return {};
+        std::memcpy(&n, b->data(), sizeof(n));
+        return n;
+    };
+    if (take(Magic.size()) != Magic) return {};
+    auto const n = take_size();
+    if (!n || take(*n) != std::string_view(key)) return {}; // hash collision or corrupt file
+    auto const m = take_size();
+    if (!m || s.size() != *m) return {};
+    return s;
+}
+
+/******************************************************************************************/
+
+}
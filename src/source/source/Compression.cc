@@ -0,0 +1,99 @@
+/**
+ * @brief Definitions for word-wise XOR compression of records
+ *
+ * @file Compression.cc
+ */
+#include <nupack/thermo/Compression.h>
+
+namespace nupack::thermo {
+
+namespace {
+
+/******************************************************************************************/
+
+void put_varint(std::string &out, std::uint64_t n) {
+    for (; n >= 0x80; n >>= 7) out.push_back(char(n | 0x80));
+    out.push_back(char(n));
+}
+
+std::uint64_t get_varint(char const *&p, char const *e) {
+    std::uint64_t n = 0;
+    for (unsigned shift = 0; p != e && shift < 64; shift += 7) {
+        auto const c = static_cast<unsigned char>(*p++);
+        n |= std::uint64_t(c & 0x7F) << shift;
+        if (!(c & 0x80)) return n;
+    }
+    NUPACK_ERROR("compressed record is truncated");
+}
+
+std::uint64_t get_word(std::string_view s, std::size_t i) {
+    std::uint64_t w = 0;
+    auto const n = std::min<std::size_t>(8, s.size() - 8 * i);
+    for (std::size_t b = 0; b != n; ++b) w |= std::uint64_t(static_cast<unsigned char>(s[8 * i + b])) << (8 * b);
+    return w;
+}
+
+/******************************************************************************************/
+
+}
+
+std::string compress_words(std::string_view s) {
+    std::string out;
+    out.reserve(s.size() / 4 + 16);
+    put_varint(out, s.size());
+    std::size_t const words = (s.size() + 7) / 8;
+    std::uint64_t prev = 0;
+    for (std::size_t i = 0; i != words;) {
+        std::size_t zeros = 0, literals = 0;
+        while (i + zeros != words && get_word(s, i + zeros) == prev) ++zeros;
+        i += zeros;
+        auto last = prev;
+        while (i + literals != words) {
+            auto const w = get_word(s, i + literals);
+            if (w == last) break;
+            last = w;
+            ++literals;
+        }
+        put_varint(out, zeros);
+        put_varint(out, literals);
+        for (std::size_t k = 0; k != literals; ++k, ++i) {
+            auto const w = get_word(s, i);
+            auto x = w ^ prev;
+            char n = 0;
+            for (auto y = x; y; y >>= 8) ++n;
+            out.push_back(n);
+            for (; n; --n, x >>= 8) out.push_back(char(x & 0xFF));
+            prev = w;
+        }
+    }
+    return out;
+}
+
+std::string decompress_words(std::string_view s) {
+    char const *p = s.data(), *e = s.data() + s.size();
+    auto const size = get_varint(p, e);
+    std::string out;
+    out.reserve(size + 8);
+    std::uint64_t prev = 0;
+    auto put_word = [&](std::uint64_t w) {for (int b = 0; b != 8; ++b) out.push_back(char((w >> (8 * b)) & 0xFF));};
+    while (out.size() < size) {
+        auto const zeros = get_varint(p, e), literals = get_varint(p, e);
+        for (std::uint64_t k = 0; k != zeros; ++k) put_word(prev);
+        for (std::uint64_t k = 0; k != literals; ++k) {
+            if (p == e) NUPACK_ERROR("compressed record is truncated");
+            int const n = static_cast<unsigned char>(*p++);
+            if (n > 8 || e - p < n) NUPACK_ERROR("compressed record is corrupt");
+            std::uint64_t x = 0;
+            for (int b = 0; b != n; ++b) x |= std::uint64_t(static_cast<unsigned char>(*p++)) << (8 * b);
+            prev ^= x;
+            put_word(prev);
+        }
+        if (!zeros && !literals) NUPACK_ERROR("compressed record is corrupt");
+    }
+    out.resize(size);
+    return out;
+}
+
+/******************************************************************************************/
+
+}
@@ -1,4 +1,7 @@
 #include <nupack/concentration/Solve.h>
+#include <nupack/execution/Local.h>
+#include <nupack/reflect/Hash.h>
+#include <unordered_map>
 
 namespace nupack::concentration {
 
@@ -13,48 +16,161 @@ auto maxmap(V &&v, T const &init, F &&f={}) {
 
 /******************************************************************************************/
 
-struct LexicographicalCompare {
-    template <class T, class U>
-    bool operator()(T const &t, U const &u) const {
-        return std::lexicographical_compare(begin_of(t), end_of(t), begin_of(u), end_of(u));
-    }
-};
+/// solve_complexes() uses the sparse solvers when fewer than 1 / SparseRatio of the entries of A are nonzero
+static constexpr usize SparseRatio = 8;
 
-Output<real> equilibrate(Mat<real> const &A, Col<real> logb, Col<real> const &logq, Options const &ops) {
+/******************************************************************************************/
+
+void check_log_pfuncs(Col<real> const &logq) {
     if (logq.has_nan()) throw std::domain_error("Input log Q contains NaN");
     if (logq.max() == real(*inf)) throw std::domain_error("Input log Q contains +inf");
+}
 
-    // Reduce complexes of the same composition
-    std::map<Col<real>, real, LexicographicalCompare> unique;
-    izip(logq, [&](auto i, auto logq) {
-        if (logq == -real(*inf)) return;
-        Col<real> a = A.row(i).t();
-        auto &p = unique.try_emplace(std::move(a), -real(*inf)).first->second;
-        p = log_sum_exp(p, logq);
-    });
+/******************************************************************************************/
+
+/// Composition of a complex as its (strand, count) nonzeros in increasing strand order
+using Signature = small_vec<std::pair<la::uword, real>, 8>;
 
-    Mat<real> A2(unique.size(), A.n_cols);
-    Col<real> logq2(unique.size());
-    izip(unique, [&](auto i, auto const &p) {
-        A2.row(i) = p.first.t();
-        logq2(i) = p.second;
+Signature signature(Mat<real> const &A, usize c) {
+    Signature out;
+    for (auto s : range(A.n_cols)) if (A(c, s) != 0) out.emplace_back(s, A(c, s));
+    return out;
+}
+
+/// At is the transposed coefficient matrix so that the nonzeros of complex c are contiguous
+Signature signature(SpMat<real> const &At, usize c) {
+    Signature out;
+    for (auto p : range(At.col_ptrs[c], At.col_ptrs[c+1])) out.emplace_back(At.row_indices[p], At.values[p]);
+    return out;
+}
+
+Mat<real> coefficient_matrix(type_t<Mat<real>>, vec<Signature> const &rows, usize n_strands) {
+    Mat<real> A(len(rows), n_strands, arma::fill::zeros);
+    izip(rows, [&](auto i, auto const &r) {for (auto const &[s, n] : r) A(i, s) = n;});
+    return A;
+}
+
+SpMat<real> coefficient_matrix(type_t<SpMat<real>>, vec<Signature> const &rows, usize n_strands) {
+    la::umat locations(2, sum(rows, [](auto const &r) {return len(r);}));
+    Col<real> values(locations.n_cols);
+    usize k = 0;
+    izip(rows, [&](auto i, auto const &r) {
+        for (auto const &[s, n] : r) {locations(0, k) = i; locations(1, k) = s; values(k++) = n;}
     });
+    return SpMat<real>(locations, values, len(rows), n_strands);
+}
+
+/******************************************************************************************/
+
+/// Complexes of the same composition reduced to one row each, summing their partition functions
+template <class M>
+struct MergedComplexes {
+    static constexpr usize Dropped = usize(-1);
+
+    M A;
+    Col<real> logq;
+    /// merged row of each original complex, or Dropped if its partition function is 0
+    vec<usize> rows;
+
+    /// Merging is expected linear time: compositions are hashed rather than compared
+    MergedComplexes(M const &A0, Col<real> const &logq0) : rows(len(logq0), Dropped) {
+        std::unordered_map<Signature, usize, RangeHash<Signature>> unique;
+        vec<Signature> compositions;
+        vec<real> merged;
+        // a sparse A is read through its transpose, whose columns hold the nonzeros of each complex
+        M const At = la::is_sparse<M> ? M(A0.t()) : M();
+        auto const &source = la::is_sparse<M> ? At : A0;
+        izip(logq0, [&](auto c, auto q) {
+            if (q == -real(*inf)) return;
+            auto sig = signature(source, c);
+            auto it = unique.try_emplace(sig, len(compositions)).first;
+            if (it->second == len(compositions)) {compositions.emplace_back(std::move(sig)); merged.emplace_back(q);}
+            else merged[it->second] = log_sum_exp(merged[it->second], q);
+            rows[c] = it->second;
+        });
+        A = coefficient_matrix(type_c<M>, compositions, A0.n_cols);
+        logq = Col<real>(merged);
+    }
+
+    /// Concentrations of the original complexes from those of the merged rows
+    Col<real> expand(Col<real> const &x, Col<real> const &logq0) const {
+        Col<real> out(len(rows));
+        izip(rows, [&](auto c, auto r) {out(c) = r == Dropped ? 0 : x(r) * std::exp(logq0(c) - logq(r));});
+        return out;
+    }
+};
+
+/******************************************************************************************/
 
-    auto out = equilibrate_finite<real>(A2, logb, logq2, ops);
-    out.solution = la::exp(A * out.dual_solution + logq);
+template <class M>
+Output<real> equilibrate_merged(Local const &env, M const &A, Col<real> const &logb, Col<real> const &logq, Options const &ops) {
+    check_log_pfuncs(logq);
+    MergedComplexes<M> const merged(A, logq);
+    auto out = equilibrate_finite<real>(env, merged.A, logb, merged.logq, ops);
+    out.solution = merged.expand(out.solution, logq);
     return out;
 }
 
+Output<real> equilibrate(Mat<real> const &A, Col<real> logb, Col<real> const &logq, Options const &ops) {
+    return equilibrate_merged(Local(), A, logb, logq, ops);
+}
+
+Output<real> equilibrate(SpMat<real> const &A, Col<real> logb, Col<real> const &logq, Options const &ops) {
+    return equilibrate_merged(Local(), A, logb, logq, ops);
+}
+
+/******************************************************************************************/
+
+template <class M>
+vec<Output<real>> equilibrate_series(Local const &env, M const &A, Mat<real> const &logb, Col<real> const &logq, Options const &ops) {
+    check_log_pfuncs(logq);
+    NUPACK_REQUIRE(logb.n_rows, ==, A.n_cols, "Incorrect number of strand concentrations given");
+    MergedComplexes<M> const merged(A, logq);
+    usize const n = logb.n_cols;
+
+    // Complex concentrations matching every point's strand totals share one factorisation of A
+    Mat<real> x0;
+    if (ops.method != Method::fit) x0 = least_squares(M(merged.A.t()), Mat<real>(la::exp(logb)));
+
+    vec<Output<real>> out(n);
+    // a few contiguous blocks per worker, each point warm-started from the last converged one
+    // (the points are already spread over the workers, so each solve itself is serial)
+    usize const n_tasks = min(n, 4 * usize(env.n_workers()));
+    env.spread(span(0, n_tasks), 1, [&](auto const &, auto t, auto) {
+        Col<real> dual;
+        for (auto i : range(t * n / n_tasks, (t + 1) * n / n_tasks)) {
+            out[i] = equilibrate_finite<real>(Local(), merged.A, Col<real>(logb.col(i)), merged.logq, ops, dual,
+                x0.empty() ? Col<real>() : Col<real>(x0.col(i)));
+            if (out[i].converged) dual = out[i].dual_solution;
+            out[i].solution = merged.expand(out[i].solution, logq);
+        }
+    });
+    return out;
+}
+
+vec<Output<real>> equilibrate_batch(Local const &env, Mat<real> const &A, Mat<real> const &logb, Col<real> const &logq, Options const &ops) {
+    return equilibrate_series(env, A, logb, logq, ops);
+}
+
+vec<Output<real>> equilibrate_batch(Local const &env, SpMat<real> const &A, Mat<real> const &logb, Col<real> const &logq, Options const &ops) {
+    return equilibrate_series(env, A, logb, logq, ops);
+}
+
 /******************************************************************************************/
 
-Output<real> solve_complexes(vec<small_vec<uint>> const &indices, Col<real> logq, Col<real> x0, Options const &ops, bool rotational_correction, bool as_strands) {
+Output<real> solve_complexes(Local const &env, vec<small_vec<uint>> const &indices, Col<real> logq, Col<real> x0, Options const &ops, bool rotational_correction, bool as_strands) {
     NUPACK_ALL_EQUAL("Inconsistent number of complexes", len(indices), len(logq));
-    Mat<real> A(len(logq), maxmap(indices, 0, [](auto const &p) {return maxmap(p, 0) + 1;}), arma::fill::zeros);
+    usize const n_strands = maxmap(indices, 0, [](auto const &p) {return maxmap(p, 0) + 1;});
 
+    // Each complex holds a few strands, so A is assembled as CSC (duplicate entries are summed)
+    la::umat locations(2, sum(indices, [](auto const &x) {return len(x);}));
+    Col<real> ones(locations.n_cols, arma::fill::ones);
+    usize k = 0;
     izip(indices, [&](auto c, auto const &x) {
-        for (auto s : x) A(c, s) += 1;
+        for (auto s : x) {locations(0, k) = c; locations(1, k++) = s;}
         if (rotational_correction) logq(c) -= std::log(real(rotational_symmetry(x)));
     });
+    SpMat<real> A(true, locations, ones, len(logq), n_strands);
 
     NUPACK_REQUIRE(x0.min(), >, 0, "All concentrations should be positive");
 
@@ -66,7 +182,9 @@ Output<real> solve_complexes(vec<small_vec<uint>> const &indices, Col<real> logq
         x0 = la::log(A.t() * x0);
     }
 
-    return equilibrate(std::move(A), std::move(x0), std::move(logq), ops);
+    // The dense path is kept for small or dense problems where BLAS outweighs the wasted zeros
+    if (A.n_nonzero * SparseRatio < A.n_elem) return equilibrate_merged(env, A, x0, logq, ops);
+    return equilibrate_merged(env, Mat<real>(A), x0, logq, ops);
 }
 
 /******************************************************************************************/
@@ -48,6 +48,13 @@ real water_molarity(real T) {
    return a5 * (1 - (T + a1) * (T + a1) * (T + a2) / a3 / (T + a4)) / 18.0152;
 };
 
+real water_molarity_slope(real T) {
+   constexpr real const a1 = -3.983035 - ZeroCinK, a2 = 301.797 - ZeroCinK,
+                        a3 = 522528.9, a4 = 69.34881 - ZeroCinK, a5 = 999.974950;
+   real const num = (T + a1) * (T + a1) * (T + a2), dnum = (T + a1) * (3 * T + a1 + 2 * a2);
+   return -a5 * (dnum * (T + a4) - num) / (a3 * (T + a4) * (T + a4)) / 18.0152;
+}
+
 // No correction for RNA since we don't have parameters
 real dna_salt_correction(real t, real na, real mg, bool long_helix) {
   // Ignore magnesium for long helix mode (not cited why, for consistency with Mfold)
@@ -5,20 +5,38 @@
 #include <nupack/state/State.h>
 #include <nupack/reflect/Serialize.h>
 #include <fstream>
+#include <filesystem>
+#include <mutex>
+#include <list>
+#include <cstring>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#   define NUPACK_HAS_MMAP
+#endif
 
 namespace nupack {
 
 /******************************************************************************************/
 
+namespace {
+    bool ends_with(string const &s, string_view suffix) {
+        return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+}
+
 ParameterFile::ParameterFile(string p) : path(p) {
     if (path == "RNA" || path == "rna") path = "rna06";
     if (path == "DNA" || path == "dna") path = "dna04";
-    if (path.size() < 5 || path.substr(path.size() - 5) != ".json") path += ".json";
+    if (!ends_with(path, ".json") && !ends_with(path, ".bin")) path += ".json";
 }
 
 /******************************************************************************************/
 
-json ParameterFile::open() const {
+string ParameterFile::resolve() const {
     string name = path;
     // BEEP(DefaultParametersPath);
     if (!path_exists(name)) {
@@ -28,12 +46,29 @@ json ParameterFile::open() const {
         auto s = get_env("NUPACKHOME");
         if (!s.empty()) name = path_join(path_join(s, "parameters"), path);
     }
-
-    std::ifstream file(name);
-    if (!file.good()) {
+    if (!path_exists(name)) {
         vec<string> directories = {".", DefaultParametersPath, "$NUPACKHOME/parameters"};
         NUPACK_ERROR("failed to open parameter file ", path, directories);
     }
+    return name;
+}
+
+/******************************************************************************************/
+
+json ParameterFile::open() const {
+    string const name = resolve();
+    if (ends_with(name, ".bin")) {
+        auto const t = load();
+        json j;
+        j["material"] = t->material;
+        j["default_wobble_pairing"] = t->default_wobble_pairing;
+        j["dG"] = t->dG.save_repr();
+        j["dH"] = t->dH.save_repr();
+        return j;
+    }
+
+    std::ifstream file(name);
+    if (!file.good()) NUPACK_ERROR("failed to open parameter file ", name);
     json j;
     file >> j;
     return j;
@@ -41,6 +76,169 @@ json ParameterFile::open() const {
 
 /******************************************************************************************/
 
+/*
+ * Binary parameter format: a 64 byte header followed by the dG and then the dH table, each
+ * ParameterData<real>::size values of type real in native byte order. The header records
+ * the table size, value width and byte order, so a file written by a build with a different
+ * parameter layout or platform is rejected rather than misread.
+ */
+namespace {
+    constexpr std::array<char, 8> BinaryMagic = {'N', 'U', 'P', 'A', 'R', 'A', 'M', '\0'};
+    constexpr std::uint32_t BinaryVersion = 1, BinaryByteOrder = 0x01020304;
+
+    struct BinaryHeader {
+        std::array<char, 8> magic;
+        std::uint32_t version, byte_order;
+        std::uint64_t values;
+        std::uint32_t value_bytes;
+        std::uint8_t default_wobble_pairing;
+        std::array<char, 35> material;
+    };
+    static_assert(sizeof(BinaryHeader) == 64, "binary parameter header should be 64 bytes");
+
+    constexpr std::size_t BinaryTableBytes = ParameterData<real>::size * sizeof(real);
+
+    /// Read-only contents of a binary file, memory-mapped where possible
+    std::shared_ptr<char const> map_file(string const &name, std::size_t &bytes) {
+#ifdef NUPACK_HAS_MMAP
+        int const fd = ::open(name.c_str(), O_RDONLY);
+        if (fd < 0) NUPACK_ERROR("failed to open parameter file ", name);
+        struct ::stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size == 0) {::close(fd); NUPACK_ERROR("failed to read parameter file ", name);}
+        bytes = st.st_size;
+        void *p = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) NUPACK_ERROR("failed to map parameter file ", name);
+        return std::shared_ptr<char const>(static_cast<char const *>(p), [n=bytes](char const *q) {::munmap(const_cast<char *>(q), n);});
+#else
+        std::ifstream file(name, std::ios::binary | std::ios::ate);
+        if (!file.good()) NUPACK_ERROR("failed to open parameter file ", name);
+        bytes = file.tellg();
+        // allocated as real so that the tables are aligned
+        std::shared_ptr<real> buffer(new real[bytes / sizeof(real) + 1], [](real *r) {delete[] r;});
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(buffer.get()), bytes);
+        return std::shared_ptr<char const>(buffer, reinterpret_cast<char const *>(buffer.get()));
+#endif
+    }
+
+    std::shared_ptr<ParameterTables const> load_binary(string const &name) {
+        std::size_t bytes = 0;
+        auto const contents = map_file(name, bytes);
+        BinaryHeader h;
+        if (bytes < sizeof(h)) NUPACK_ERROR("binary parameter file is truncated", name);
+        std::memcpy(&h, contents.get(), sizeof(h));
+        if (h.magic != BinaryMagic || h.version != BinaryVersion || h.byte_order != BinaryByteOrder
+            || h.values != ParameterData<real>::size || h.value_bytes != sizeof(real))
+            NUPACK_ERROR("binary parameter file is not compatible with this build; recompile it from JSON", name);
+        if (bytes < sizeof(h) + 2 * BinaryTableBytes) NUPACK_ERROR("binary parameter file is truncated", name);
+
+        auto out = std::make_shared<ParameterTables>();
+        out->material.assign(h.material.data(), strnlen(h.material.data(), h.material.size()));
+        out->default_wobble_pairing = h.default_wobble_pairing;
+        // the tables alias the mapping, which they keep alive; ParameterTables only gives const access
+        auto table = [&](std::size_t i) {
+            auto p = const_cast<char *>(contents.get()) + sizeof(h) + i * BinaryTableBytes;
+            return ParameterData<real>(std::shared_ptr<real>(std::const_pointer_cast<char>(contents), reinterpret_cast<real *>(p)));
+        };
+        out->dG = table(0);
+        out->dH = table(1);
+        return out;
+    }
+
+    std::shared_ptr<ParameterTables const> load_json(ParameterFile const &f) {
+        json const j = f.open();
+        auto out = std::make_shared<ParameterTables>();
+        out->dG = ParameterData<real>(j.at("dG"));
+        out->dH = ParameterData<real>(j.at("dH"));
+        j.at("material").get_to(out->material);
+        j.at("default_wobble_pairing").get_to(out->default_wobble_pairing);
+        return out;
+    }
+
+    /// Process-wide tables, keyed by resolved path and modification time so that edited files are reloaded.
+    /// The most recently used tables are owned by the registry, so a model built after the last one was
+    /// destroyed does not parse the file again; older entries are dropped once the bound is exceeded.
+    struct ParameterRegistry {
+        using Key = std::pair<string, std::filesystem::file_time_type>;
+        static constexpr std::size_t capacity = 8;
+        std::mutex mut;
+        std::list<std::pair<Key, std::shared_ptr<ParameterTables const>>> tables; // most recently used first
+
+        std::shared_ptr<ParameterTables const> find(Key const &k) {
+            auto it = find_if(tables, [&](auto const &p) {return p.first == k;});
+            if (it == tables.end()) return {};
+            tables.splice(tables.begin(), tables, it);
+            return it->second;
+        }
+    };
+    ParameterRegistry & registry() {static ParameterRegistry r; return r;}
+}
+
+/******************************************************************************************/
+
+std::shared_ptr<ParameterTables const> ParameterFile::load() const {
+    string name = resolve();
+    if (ends_with(name, ".json")) {
+        // prefer an up-to-date binary next to the JSON file
+        string const bin = name.substr(0, name.size() - 5) + ".bin";
+        std::error_code ec;
+        auto const tj = std::filesystem::last_write_time(name, ec);
+        auto const tb = std::filesystem::last_write_time(bin, ec);
+        if (!ec && tb >= tj) name = bin;
+    }
+    std::error_code ec;
+    std::pair key{name, std::filesystem::last_write_time(name, ec)};
+
+    auto &r = registry();
+    {
+        std::lock_guard lock(r.mut);
+        if (auto t = r.find(key)) return t;
+    }
+    // load with the lock released; if two threads race, the first insertion wins
+    auto t = ends_with(name, ".bin") ? load_binary(name) : load_json(ParameterFile(name));
+    std::lock_guard lock(r.mut);
+    if (auto u = r.find(key)) return u;
+    r.tables.emplace_front(std::move(key), t);
+    if (r.tables.size() > r.capacity) r.tables.pop_back();
+    return t;
+}
+
+void ParameterFile::clear_registry() {
+    auto &r = registry();
+    std::lock_guard lock(r.mut);
+    r.tables.clear();
+}
+
+/******************************************************************************************/
+
+void ParameterFile::compile(string const &out) const {
+    auto const t = load();
+    BinaryHeader h{};
+    h.magic = BinaryMagic;
+    h.version = BinaryVersion;
+    h.byte_order = BinaryByteOrder;
+    h.values = ParameterData<real>::size;
+    h.value_bytes = sizeof(real);
+    h.default_wobble_pairing = t->default_wobble_pairing;
+    NUPACK_REQUIRE(t->material.size(), <, h.material.size(), "material name is too long for binary parameter file");
+    std::copy(t->material.begin(), t->material.end(), h.material.begin());
+
+    // write to a temporary and rename so that a concurrent load() never maps a partial file
+    string const tmp = out + ".tmp";
+    {
+        std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+        if (!file.good()) NUPACK_ERROR("failed to write parameter file ", tmp);
+        file.write(reinterpret_cast<char const *>(&h), sizeof(h));
+        file.write(reinterpret_cast<char const *>(t->dG.begin()), BinaryTableBytes);
+        file.write(reinterpret_cast<char const *>(t->dH.begin()), BinaryTableBytes);
+        if (!file.good()) NUPACK_ERROR("failed to write parameter file ", tmp);
+    }
+    std::filesystem::rename(tmp, out);
+}
+
+/******************************************************************************************/
+
 std::array<char const *, 5> EnsembleNames = {"nostacking", "stacking",  "min", "all", "none"};
 
 Ensemble as_ensemble(string_view s) {
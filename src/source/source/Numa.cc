@@ -0,0 +1,183 @@
+/**
+ * @brief Definitions for NUMA topology, thread pinning, and page release
+ *
+ * @file Numa.cc
+ */
+#include <nupack/execution/Numa.h>
+
+#include <nupack/standard/Optional.h>
+
+#include <boost/algorithm/string.hpp>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <thread>
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#   include <sys/mman.h>
+#   include <unistd.h>
+#   define NUPACK_HAS_MADVISE
+#endif
+
+#if defined(__linux__) && __has_include(<pthread.h>)
+#   include <pthread.h>
+#   include <sched.h>
+#   include <sys/syscall.h>
+#   define NUPACK_HAS_AFFINITY
+#endif
+
+namespace nupack::numa {
+
+/******************************************************************************************/
+
+namespace {
+    /// Parse a sysfs cpulist such as "0-3,8,10-11"
+    vec<int> parse_cpulist(std::string const &s) {
+        vec<int> out;
+        vec<std::string> parts;
+        boost::split(parts, s, boost::is_any_of(","));
+        for (auto &p : parts) {
+            boost::trim(p);
+            if (p.empty()) continue;
+            auto const dash = p.find('-');
+            int const b = std::stoi(p.substr(0, dash));
+            int const e = dash == std::string::npos ? b : std::stoi(p.substr(dash + 1));
+            for (int i = b; i <= e; ++i) out.push_back(i);
+        }
+        return out;
+    }
+
+    /// CPUs the process may run on, inherited e.g. from taskset or a container (empty if unknown)
+    vec<int> allowed_cpus() {
+        vec<int> out;
+#ifdef NUPACK_HAS_AFFINITY
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (::sched_getaffinity(0, sizeof(set), &set) == 0)
+            for (int i = 0; i != CPU_SETSIZE; ++i) if (CPU_ISSET(i, &set)) out.push_back(i);
+#endif
+        return out;
+    }
+
+    /// (node number, allowed CPUs) of each NUMA node which has any
+    vec<std::pair<int, vec<int>>> node_cpus() {
+        auto const allowed = allowed_cpus();
+        auto ok = [&](int c) {return allowed.empty() || std::binary_search(allowed.begin(), allowed.end(), c);};
+        vec<std::pair<int, vec<int>>> nodes;
+        for (int n = 0; ; ++n) {
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(n) + "/cpulist");
+            if (!file) break;
+            std::string line;
+            std::getline(file, line);
+            try {
+                auto cpus = parse_cpulist(line);
+                cpus.erase(std::remove_if(cpus.begin(), cpus.end(), [&](int c) {return !ok(c);}), cpus.end());
+                if (!cpus.empty()) nodes.emplace_back(n, std::move(cpus));
+            } catch (std::exception const &) {break;}
+        }
+        if (nodes.empty()) {
+            nodes.emplace_back(0, allowed);
+            if (allowed.empty())
+                for (int i = 0; i != int(std::max(1u, std::thread::hardware_concurrency())); ++i) nodes[0].second.push_back(i);
+        }
+        return nodes;
+    }
+
+    struct Topology {
+        vec<int> order, ids;
+        std::size_t nodes;
+
+        Topology() {
+            auto const cpus = node_cpus();
+            nodes = cpus.size();
+            std::size_t total = 0;
+            for (auto const &c : cpus) {total += c.second.size(); ids.push_back(c.first);}
+            for (std::size_t i = 0; order.size() != total; ++i)
+                for (auto const &c : cpus) if (i < c.second.size()) order.push_back(c.second[i]);
+        }
+    };
+
+    Topology const & topology() {static Topology const t; return t;}
+}
+
+/******************************************************************************************/
+
+vec<int> const & cpu_order() {return topology().order;}
+
+std::size_t n_nodes() {return topology().nodes;}
+
+std::size_t next_pinning_offset(std::size_t slots) {
+    static std::atomic<std::size_t> next{0};
+    auto const n = std::max<std::size_t>(cpu_order().size(), 1);
+    return next.fetch_add(slots) % n;
+}
+
+/******************************************************************************************/
+
+#ifdef NUPACK_HAS_AFFINITY
+namespace {
+    /// Affinity of this thread before it was first pinned
+    thread_local Optional<cpu_set_t> unpinned;
+}
+#endif
+
+bool pin_this_thread(int cpu) {
+#ifdef NUPACK_HAS_AFFINITY
+    if (!unpinned) {
+        cpu_set_t old;
+        if (::pthread_getaffinity_np(::pthread_self(), sizeof(old), &old) != 0) return false;
+        unpinned = old;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+void unpin_this_thread() {
+#ifdef NUPACK_HAS_AFFINITY
+    if (!unpinned) return;
+    ::pthread_setaffinity_np(::pthread_self(), sizeof(*unpinned), &*unpinned);
+    unpinned.reset();
+#endif
+}
+
+/******************************************************************************************/
+
+void release_pages(void *p, std::size_t bytes) {
+#ifdef NUPACK_HAS_MADVISE
+    static std::uintptr_t const page = ::sysconf(_SC_PAGESIZE);
+    auto const b = (reinterpret_cast<std::uintptr_t>(p) + page - 1) / page * page;
+    auto const e = (reinterpret_cast<std::uintptr_t>(p) + bytes) / page * page;
+    if (e > b) ::madvise(reinterpret_cast<void *>(b), e - b, MADV_DONTNEED);
+#endif
+}
+
+/******************************************************************************************/
+
+bool interleave_pages(void *p, std::size_t bytes) {
+#if defined(NUPACK_HAS_MADVISE) && defined(__linux__) && defined(SYS_mbind)
+    auto const &t = topology();
+    if (t.nodes < 2) return false;
+    constexpr int interleave = 3; // MPOL_INTERLEAVE from <numaif.h>, which needs libnuma
+    constexpr std::size_t word = 8 * sizeof(unsigned long);
+    vec<unsigned long> mask(*std::max_element(t.ids.begin(), t.ids.end()) / word + 1, 0);
+    for (auto n : t.ids) mask[n / word] |= 1ul << (n % word);
+
+    static std::uintptr_t const page = ::sysconf(_SC_PAGESIZE);
+    auto const b = (reinterpret_cast<std::uintptr_t>(p) + page - 1) / page * page;
+    auto const e = (reinterpret_cast<std::uintptr_t>(p) + bytes) / page * page;
+    if (e <= b) return false;
+    // the kernel reads maxnode - 1 bits of the mask
+    return ::syscall(SYS_mbind, b, e - b, interleave, mask.data(), mask.size() * word + 1, 0u) == 0;
+#else
+    return false;
+#endif
+}
+
+/******************************************************************************************/
+
+}
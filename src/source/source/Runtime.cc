@@ -18,6 +18,7 @@
 namespace nupack {
 
 thread_local std::shared_ptr<std::atomic<int>> ThreadLocalSignal = {};
+thread_local std::shared_ptr<JobControl> ThreadLocalJob = {};
 
 
 /******************************************************************************************/
@@ -144,6 +145,17 @@ void throw_if_signal() {
     // Check system level signal
     if (!i) {i = StaticSignal; StaticSignal = 0;}
     if (i) throw SignalError(i);
+    // Check cancellation and limits of the current job
+    if (ThreadLocalJob) ThreadLocalJob->check();
+}
+
+char const * JobInterrupted::make_name(JobStop r) {
+    switch(r) {
+        case(JobStop::cancelled): return "job was cancelled";
+        case(JobStop::timeout):   return "job exceeded its time limit";
+        case(JobStop::memory):    return "job exceeded its memory limit";
+        default: return "job was interrupted";
+    }
 }
 
 extern "C" void set_nupack_static_signal(int i) {StaticSignal = i;}
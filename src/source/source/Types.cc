@@ -251,6 +251,89 @@ std::size_t PairList::symmetry() const {
 
 /******************************************************************************************/
 
+namespace {
+    /// Lowest rotation of a complex and the number of strands it was rotated by
+    std::pair<Complex, uint> lowest_complex(Complex const &c) {
+        auto const v = c.views();
+        uint const shift = lowest_rotational_order(v);
+        if (shift == 0) {
+            Complex k = c;
+            k.offset = 0; // the offset of a subcomplex is not part of its identity
+            return {std::move(k), shift};
+        }
+        StrandList s(v.begin(), v.end());
+        std::rotate(s.begin(), s.begin() + shift, s.end());
+        return {Complex(s), shift};
+    }
+}
+
+namespace {
+    /// Hash of the strand views v read from the strand at shift onwards
+    template <class V>
+    std::size_t rotated_hash(V const &v, uint shift) {
+        std::size_t h = len(v);
+        for (auto i : indices(v)) boost::hash_combine(h, range_hash(v[(i + shift) % len(v)]));
+        return h;
+    }
+}
+
+CanonicalComplex::CanonicalComplex(Complex const &c) {
+    auto [k, s] = lowest_complex(c);
+    auto const h = rotated_hash(k.views(), 0);
+    entry = std::make_shared<Entry const>(Entry{std::move(k), h, 0});
+    shift = s;
+}
+
+std::pair<std::size_t, uint> CanonicalComplex::probe(Complex const &c) {
+    auto const v = c.views();
+    uint const s = lowest_rotational_order(v);
+    return {rotated_hash(v, s), s};
+}
+
+bool CanonicalComplex::matches(Complex const &c, uint s) const {
+    auto const &k = complex();
+    if (k.n_strands() != c.n_strands() || len(k.catenated) != len(c.catenated)) return false;
+    auto const u = k.views(), v = c.views();
+    for (auto i : indices(u)) if (u[i] != v[(i + s) % len(v)]) return false;
+    return true;
+}
+
+std::size_t ComplexTable::Hash::operator()(Complex const &c) const {return std::hash<Complex>()(c);}
+
+CanonicalComplex ComplexTable::intern(Complex const &c) {
+    auto [k, s] = lowest_complex(c);
+    {
+        std::shared_lock lock(mut);
+        if (auto it = map.find(k); it != map.end())
+            if (auto e = it->second.lock()) return {std::move(e), s};
+    }
+    std::unique_lock lock(mut);
+    auto &ref = map[k];
+    if (auto e = ref.lock()) return {std::move(e), s};
+    auto const h = rotated_hash(k.views(), 0);
+    auto e = std::make_shared<CanonicalComplex::Entry const>(CanonicalComplex::Entry{std::move(k), h, ++count});
+    ref = e;
+    if (map.size() >= 2 * pruned_size) drop_expired();
+    return {std::move(e), s};
+}
+
+std::size_t ComplexTable::size() const {
+    std::shared_lock lock(mut);
+    return map.size();
+}
+
+void ComplexTable::prune() {
+    std::unique_lock lock(mut);
+    drop_expired();
+}
+
+void ComplexTable::drop_expired() {
+    for (auto it = map.begin(); it != map.end();) it = it->second.expired() ? map.erase(it) : std::next(it);
+    pruned_size = std::max<std::size_t>(map.size(), 16);
+}
+
+/******************************************************************************************/
+
 }
 
 /******************************************************************************************/
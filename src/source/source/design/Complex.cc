@@ -14,7 +14,7 @@ namespace nupack { namespace newdesign {
  * @return [description]
  */
 real Complex::log_pfunc(Local env, ModelMap const &map, Sequence const &s, EngineObserver &obs) const {
-    env = threshold(env, *this);
+    env = threshold(env, *this, target.environment(map), false);
     return newdesign::partition_function(env, to_nick_sequence(strands, s), target.environment(map), obs)
          - symmetry_correction()
          - target.model.beta * bonus;
@@ -61,7 +61,7 @@ real Complex::log_pf_single_strands(Local env, ModelMap const &map, Sequence con
 Tensor<real, 2> Complex::pair_probabilities(Local env, ModelMap const &map, Sequence const &s, EngineObserver &obs) const {
     /* skip entirely if no target structure as it won't be used */
     if (!is_on_target()) return {};
-    env = threshold(env, *this);
+    env = threshold(env, *this, target.environment(map), true);
     return newdesign::pair_probability(env, to_nick_sequence(strands, s), target.environment(map), obs).first;
 };
 
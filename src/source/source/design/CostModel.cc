@@ -0,0 +1,182 @@
+#include <nupack/design/CostModel.h>
+#include <nupack/design/Models.h>
+#include <nupack/design/ThermoWrapper.h>
+#include <nupack/types/Matrix.h>
+#include <nupack/reflect/Serialize.h>
+#include <nupack/common/Runtime.h>
+#include <nupack/algorithms/Utility.h>
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+
+namespace nupack { namespace newdesign {
+
+namespace {
+
+/// complex sizes timed during calibration
+constexpr std::array<std::size_t, 4> CalibrationLengths = {48, 96, 160, 240};
+
+/// fixed crossover used for sizes the calibration does not cover, where the fit is not trusted
+constexpr std::size_t SerialThreshold = 500;
+
+bool calibrated(std::size_t n) {return CalibrationLengths.front() <= n && n <= CalibrationLengths.back();}
+
+/**
+ * @brief least squares fit of times to the given basis columns of (n^3, n, 1)
+ * @details negative coefficients, which can come from timing noise, are set
+ *     to zero so that predictions stay monotone in n
+ */
+ExecutionCost fit_cost(vec<real> const &n, vec<real> const &t, bool linear) {
+    uint const k = linear ? 3 : 2;
+    real_mat X(len(n), k, arma::fill::ones);
+    for (auto i : indices(n)) {
+        X(i, 0) = n[i] * n[i] * n[i];
+        if (linear) X(i, 1) = n[i];
+    }
+    real_col y(t);
+    real_col beta = solve(X.t() * X, X.t() * y);
+    ExecutionCost out;
+    out.cubic = std::max<real>(beta(0), 0);
+    if (linear) out.linear = std::max<real>(beta(1), 0);
+    out.constant = std::max<real>(beta(k - 1), 0);
+    return out;
+}
+
+/// shortest of a few timings of one uncached evaluation of a random single strand
+real time_evaluation(Local const &env, ThermoEnviron &t_env, std::size_t n, bool pairs) {
+    std::mt19937 gen(n);
+    auto mods = t_env.doubled();
+    real best = std::numeric_limits<real>::infinity();
+    for (int rep = 0; rep != 2; ++rep) {
+        ::nupack::Complex seq{Strand(random_sequence(n, 0.5, gen))};
+        best = std::min<real>(best, time_it([&] {
+            if (pairs) time_sink(pair_probability(env, seq, mods).second);
+            else time_sink(partition_function(env, seq, mods));
+        }));
+    }
+    return best;
+}
+
+/// serial and parallel fits from timings of each calibration length
+ExecutionProfile calibrate(Local const &like, ThermoEnviron &t_env, bool pairs) {
+    // a fresh arena of the same size: the caller's may have every slot held by blocked tasks
+    Local const env(like.n_workers(), like.numa());
+    vec<real> n, serial, parallel;
+    for (auto l : CalibrationLengths) {
+        n.emplace_back(l);
+        serial.emplace_back(time_evaluation(Local(), t_env, l, pairs));
+        parallel.emplace_back(time_evaluation(env, t_env, l, pairs));
+    }
+    return {fit_cost(n, serial, false), fit_cost(n, parallel, true)};
+}
+
+string profile_key(Local const &env, ThermoEnviron const &t_env, bool pairs) {
+    auto const ensemble = static_cast<int>(std::get<0>(t_env.models).energy_model.ensemble);
+    return std::to_string(ensemble) + (pairs ? "-pairs-" : "-pfunc-") + std::to_string(env.n_workers());
+}
+
+}
+
+/******************************************************************************************/
+
+CostModel::CostModel(string path) : file(std::move(path)) {
+    std::ifstream in(file);
+    if (!in) return;
+    try {profiles = json::parse(in).get<decltype(profiles)>();}
+    catch (std::exception const &) {profiles.clear();} // unreadable file: recalibrate and overwrite
+}
+
+string CostModel::default_path() {
+    if (auto s = get_env("NUPACK_COST_MODEL"); !s.empty()) return s;
+    if (auto s = get_env("HOME"); !s.empty()) return path_join(path_join(s, ".nupack"), "thermo-costs.json");
+    return "nupack-thermo-costs.json";
+}
+
+CostModel & CostModel::global() {
+    static CostModel model(default_path());
+    return model;
+}
+
+/******************************************************************************************/
+
+void CostModel::save() const {
+    std::error_code ec;
+    auto const p = std::filesystem::path(file);
+    if (p.has_parent_path()) std::filesystem::create_directories(p.parent_path(), ec);
+    auto const tmp = file + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::trunc);
+        if (!out) return; // not fatal: the profile is just recalibrated next time
+        out << json(profiles).dump(2);
+    }
+    std::filesystem::rename(tmp, file, ec);
+}
+
+/******************************************************************************************/
+
+ExecutionProfile CostModel::profile(Local const &env, ThermoEnviron &t_env, bool pairs) {
+    auto const key = profile_key(env, t_env, pairs);
+    {
+        std::shared_lock lock(mut);
+        if (auto it = profiles.find(key); it != profiles.end()) return it->second;
+    }
+    // one calibration at a time, so that concurrent calibrations do not skew each other's timings
+    std::lock_guard guard(calibration);
+    {
+        std::shared_lock lock(mut);
+        if (auto it = profiles.find(key); it != profiles.end()) return it->second;
+    }
+    // time on a dedicated thread: the caller may be a worker of an enclosing parallel region,
+    // whose other tasks must neither run inside nor be stolen by the timed evaluations. The
+    // interrupt signal carries over but the job does not, so calibration is not counted as progress.
+    ExecutionProfile p;
+    std::exception_ptr err;
+    std::thread([&, signal=ThreadLocalSignal] {
+        ThreadLocalSignal = signal;
+        try {p = calibrate(env, t_env, pairs);}
+        catch (...) {err = std::current_exception();}
+    }).join();
+    if (err) std::rethrow_exception(err);
+
+    std::unique_lock lock(mut);
+    auto const &out = profiles.try_emplace(key, p).first->second;
+    save();
+    return out;
+}
+
+/******************************************************************************************/
+
+bool CostModel::parallel_faster(Local const &env, ThermoEnviron &t_env, std::size_t n, bool pairs) {
+    if (env.n_workers() == 1) return false;
+    if (!calibrated(n)) return n > SerialThreshold;
+    auto const p = profile(env, t_env, pairs);
+    return p.parallel(n) < p.serial(n);
+}
+
+/******************************************************************************************/
+
+bool CostModel::prefer_outer(Local const &env, ThermoEnviron &t_env, vec<std::size_t> const &sizes, bool pairs) {
+    auto const w = env.n_workers();
+    if (w == 1 || len(sizes) <= 1) return false;
+    // outside the calibrated sizes, run side by side only what the fixed threshold would run serially
+    if (!std::all_of(sizes.begin(), sizes.end(), calibrated))
+        return std::all_of(sizes.begin(), sizes.end(), [](auto n) {return n <= SerialThreshold;});
+    auto const p = profile(env, t_env, pairs);
+    // one at a time, each internally parallel if that is faster
+    real inner = 0;
+    for (auto n : sizes) inner += std::min(p.serial(n), p.parallel(n));
+    // concurrently and serially: longest-first list scheduling onto w workers
+    auto sorted = sizes;
+    std::sort(sorted.begin(), sorted.end(), std::greater<>());
+    vec<real> loads(std::min<std::size_t>(w, len(sorted)), 0);
+    for (auto n : sorted) *std::min_element(loads.begin(), loads.end()) += p.serial(n);
+    real const outer = *std::max_element(loads.begin(), loads.end());
+    return outer <= inner;
+}
+
+/******************************************************************************************/
+
+}}
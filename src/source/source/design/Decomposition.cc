@@ -211,11 +211,12 @@ ThermoData ComplexNode::dynamic_program(Local env, ThermoEnviron &t_env, Sequenc
         }
 
 
-        decltype(newdesign::pair_probability(threshold(env, *this), seq, t_env, obs)) ret;
+        auto const node_env = threshold(env, *this, t_env, true);
+        decltype(newdesign::pair_probability(node_env, seq, t_env, obs)) ret;
         if (len(enforced_pairs) == 0) {
-            ret = newdesign::pair_probability(threshold(env, *this), seq, t_env, obs);
+            ret = newdesign::pair_probability(node_env, seq, t_env, obs);
         } else {
-            ret = newdesign::pair_probability(threshold(env, *this), seq, mods, enforced_pairs, params.dG_clamp, obs);
+            ret = newdesign::pair_probability(node_env, seq, mods, enforced_pairs, params.dG_clamp, obs);
         }
 
         /* convert raw N^2 probability matrix to sparse matrix */
@@ -241,12 +242,20 @@ ThermoData ComplexNode::dynamic_program(Local env, ThermoEnviron &t_env, Sequenc
             }
         }
 
-        /* evaluate all children, potentially in parallel */
+        /* evaluate all children: many small ones concurrently and serially, few large ones
+           one at a time with each using every worker, whichever the cost model predicts is faster */
         auto eval = [&](auto const &env, auto i) {
             auto const &c = *at(to_evaluate, i);
             return c.dynamic_program(env, t_env, s, depth-1, params, indiv, obs);
         };
-        vec<ThermoData> child_results = env.map(len(to_evaluate), 1, eval);
+        vec<ThermoData> child_results;
+        auto const sizes = vmap<vec<std::size_t>>(to_evaluate, [](auto const *c) {return std::size_t(len(*c));});
+        if (CostModel::global().prefer_outer(env, t_env, sizes, true)) {
+            child_results = env.map(len(to_evaluate), 1, [&](auto const &, auto i) {return eval(Local(), i);});
+        } else {
+            child_results.reserve(len(to_evaluate));
+            for (auto i : indices(to_evaluate)) child_results.emplace_back(eval(env, i));
+        }
 
         /* join pairs of children, potentially in parallel */
         auto join = [&](auto const &env, auto i) {
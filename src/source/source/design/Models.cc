@@ -13,21 +13,27 @@ void ThermoEnviron::initialize_cache(std::size_t ram) {
 
 ThermoEnviron & ModelMap::get(Model<real> const &key) const {
     // std::lock_guard<std::mutex> lk(mut.mut)
-    return mod_map.try_emplace(key, key).first->second;
+    return mod_map.try_emplace(key.fingerprint(), key).first->second;
+}
+
+
+ThermoEnviron * ModelMap::find(Fingerprint const &key) const {
+    auto it = mod_map.find(key);
+    return it == mod_map.end() ? nullptr : &it->second;
 }
 
 
 void ThermoEnviron::add_pfunc(::nupack::Complex const &s, real log_pfunc) {
     std::unique_lock lock(mut.mut);
-    log_pfuncs.try_emplace(s, log_pfunc);
+    // interned only when new, so repeated results do not touch the complex table
+    if (!log_pfuncs.find(s)) log_pfuncs.insert(complexes.intern(s), log_pfunc);
 }
 
 
 Variant<bool, real> ThermoEnviron::get_pfunc(::nupack::Complex const &s) const {
     std::shared_lock lock(mut.mut);
-    auto it = log_pfuncs.find(s);
-    if (it == end_of(log_pfuncs)) return false;
-    return it->second;
+    if (auto p = log_pfuncs.find(s)) return *p;
+    return false;
 }
 
 
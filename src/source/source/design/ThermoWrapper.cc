@@ -98,7 +98,7 @@ std::pair<thermo::Tensor<real, 2>, real> pair_probability(
             auto it = underlying_cache.find(seqs);
             if (it != end_of(underlying_cache)) {
                 BEEP(it->first);
-                BEEP(fork(it->second, [](auto const &x) {return std::get<1>(x.contents).size();}));
+                BEEP(fork(it->second, [](auto const &x) {return std::get<1>(thermo::decompressed(x).contents).size();}));
             }
 
             BEEP(seqs);
@@ -147,18 +147,18 @@ std::pair<thermo::Tensor<real, 2>, real> pair_probability(
     std::get<2>(bonuses) = simd::ifrexp(exp_bonus);
     std::get<3>(bonuses) = simd::ifrexp(exp_bonus);
 
-    auto pairing = [&, n=len(seqs)](auto i, auto j, bool can_pair, auto const & A,
+    // precomputed so that the QB recursion does not scan fixed_pairs for every (i, j)
+    thermo::PairMask fixed_mask(len(seqs));
+    for (auto const &sp : fixed_pairs) fixed_mask.set(sp.first, sp.second);
+
+    auto pairing = [&](auto i, auto j, bool can_pair, auto const & A,
                 auto const &block, auto const & s, auto const &model, auto && recursion) {
         auto orig_i = i + s.offset, orig_j = j + s.offset;
         auto distance = std::abs(int(orig_i) - int(orig_j));
 
-        /* modulo and swap necessary so that bonuses are added to both Q^b(i,j)
-        and Q^b(j, i+n) */
-        i = orig_i % n;
-        j = orig_j % n;
-        if (j < i) std::swap(i, j);
-        // normal behavior; early exit
-        bool fixed = contains(fixed_pairs, SplitPoint{i, j});
+        /* the mask wraps indices modulo n and is symmetric so that bonuses are
+        added to both Q^b(i,j) and Q^b(j, i+n) */
+        bool fixed = fixed_mask(orig_i, orig_j);
         bool adjacent = distance == 1;
         bool normal = !fixed && can_pair;
         using V = value_type_of<decltype(block)>;
@@ -172,7 +172,7 @@ std::pair<thermo::Tensor<real, 2>, real> pair_probability(
     };
 
     real pfunc;
-    bool use_B = contains(fixed_pairs, SplitPoint{0, len(seqs) - 1});
+    bool use_B = fixed_mask(0, len(seqs) - 1);
     auto obs = [&](auto const &m) {if (m.sequences == seqs.views()) pfunc = m.raw_result;};
 
     decltype(thermo::bonus_pair_probability<3, 0, 0, 1, 1>(env, seqs, models, False(), obs, pairing, use_B)) ret;
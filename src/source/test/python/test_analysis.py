@@ -1,5 +1,6 @@
 from nupack import SetSpec, RawStrand, RawComplex, Strand, Complex, Tube, tube_analysis, \
     Model, complex_analysis, complex_concentrations, Domain, TargetStrand, analysis
+from nupack.named import heuristic_tube_analysis
 import numpy as np
 
 ################################################################################
@@ -65,6 +66,27 @@ def test_tube_analysis():
 
 ################################################################################
 
+def test_heuristic_tube_analysis():
+    A = Strand('CTGATCGAT', name='A')
+    B = Strand('GATCGTAGTC', name='B')
+    t = Tube({A: 1e-8, B: 1e-9}, complexes=SetSpec(3), name='t')
+    full = tube_analysis([t], model=Model())[t].complex_concentrations
+
+    # without a threshold every complex is reached, so the full enumeration is recovered
+    pruned = heuristic_tube_analysis({A: 1e-8, B: 1e-9}, max_size=3, threshold=0, model=Model())
+    x = next(iter(pruned.tubes.values())).complex_concentrations
+    assert set(x) == set(full)
+    assert all(np.isclose(x[c], full[c], rtol=1e-6, atol=1e-20) for c in full)
+
+    pruned = heuristic_tube_analysis({A: 1e-8, B: 1e-9}, max_size=3, threshold=1e-9, model=Model())
+    x = next(iter(pruned.tubes.values())).complex_concentrations
+    assert set(x) <= set(full)
+    # the kept complexes can only differ by the strands which the left out complexes hold
+    missing = sum(full[c] * len(c.strands) for c in full if c not in x)
+    assert all(abs(x[c] - full[c]) <= 1e-6 * full[c] + missing + 1e-20 for c in x)
+
+################################################################################
+
 def test_tube_analysis_4():
     a = Strand('CAGTCGATC', name='a')
     b = Strand('ATCGACGTA', name='b')
@@ -149,3 +171,41 @@ def test_overflow():
 
 ################################################################################
 
+def test_ensemble_energies():
+    s = RawComplex(['GGGAAACCCAUAUGGGAAACCC'])
+    g, h, dS = analysis.ensemble_energies(s, Model(celsius=37))
+    assert abs(g - analysis.pfunc(s, Model(celsius=37))[1]) < 1e-4
+    # the entropy is -dG/dT
+    lo, hi = (analysis.pfunc(s, Model(celsius=c))[1] for c in (36.5, 37.5))
+    assert abs(dS + (hi - lo)) < 1e-3
+    assert abs(h - (g + (37 + 273.15) * dS)) < 1e-6
+    # the enthalpy is -T^2 d(G/T)/dT, checked independently of the entropy
+    T = 37 + 273.15
+    assert abs(h + T**2 * (hi / (T + 0.5) - lo / (T - 0.5))) < 1e-2
+
+def test_pfunc_gradient():
+    s = RawComplex(['GGGAAACCCAUAUGGGAAACCC'])
+    model = Model()
+    logq, grad = analysis.pfunc_gradient(s, model)
+    lnq = lambda m: -m.beta * analysis.pfunc(s, m)[1]
+    assert abs(logq - lnq(model)) < 1e-8
+    assert np.isfinite(grad).all() and (grad != 0).any()
+    # the gradient is exact, so it matches central finite differences of log Q
+    h = 1e-4
+    for i in list(np.argsort(-abs(grad))[:5]) + [int(np.flatnonzero(grad == 0)[0])]:
+        p = model.parameter(int(i))
+        fd = (lnq(model.with_parameter(int(i), p + h)) - lnq(model.with_parameter(int(i), p - h))) / (2 * h)
+        assert abs(fd - grad[i]) < 1e-6 + 1e-4 * abs(grad[i]), (i, fd, grad[i])
+
+def test_pfunc_gradients():
+    keys = ['GGGAAACCCAUAUGGGAAACCC', 'GGGAAACCC+GGGUUUCCC']
+    records = {k: dict(result=0.0, material='rna', T=37.0, sodium=1.0, magnesium=0.0) for k in keys}
+    records[keys[1]]['T'] = 50.0
+    out = analysis.pfunc_gradients(records, ensemble='stacking')
+    assert sorted(out) == sorted(keys)
+    for k, celsius in zip(keys, (37, 50)):
+        logq, grad = analysis.pfunc_gradient(RawComplex(k.split('+')), Model(material='rna', celsius=celsius))
+        assert abs(out[k][0] - logq) < 1e-10
+        assert np.allclose(out[k][1], grad, rtol=1e-10, atol=0)
+
+################################################################################
@@ -0,0 +1,94 @@
+from nupack import Model, RawComplex, thermo, core
+import concurrent.futures
+import numpy as np
+
+################################################################################
+
+SEQUENCES = ['GGGAAACCCAUAUGGGAAACCC', 'AGTCTAGGATTCGGCGTGGGTTAA+TTAACCCACGCCGAATCCTAGACT',
+    'CTGATCGATCTGATCGAT+GATCGTAGTC', 'GATCGTAGTCGATCGTAGTC+CTGATCGAT+GATCGTAGTC']
+
+def logq(strands, cache, model=Model(), gil=True):
+    '''log partition function of a complex using a given cache (0 for none)'''
+    models = [thermo.CachedModel(model=model, kind='pf', bits=64)]
+    return thermo.dynamic_program(env=core.Local(), strands=RawComplex(strands.split('+')),
+        models=models, cache=cache, observe=None, pairing=thermo.obs(), gil=gil)
+
+################################################################################
+
+def test_sharded_cache_threads():
+    model = Model()
+    expect = [logq(s, 0, model) for s in SEQUENCES]
+    # large enough to hold everything, then small enough that the shards keep evicting
+    for nbytes in (10**8, 10**4):
+        cache = thermo.ShardedCache(nbytes, model.ensemble)
+        with concurrent.futures.ThreadPoolExecutor(4) as pool:
+            got = list(pool.map(lambda s: logq(s, cache, model, gil=False), SEQUENCES * 8))
+        assert np.allclose(got, expect * 8, rtol=1e-10)
+        # a shard never evicts the record it has just inserted
+        assert cache.size() > 0
+        if nbytes == 10**8:
+            assert cache.length() <= cache.capacity()
+
+################################################################################
+
+def test_disk_cache_round_trip(tmp_path):
+    model = Model()
+    energy_model = thermo.CachedModel(model=model, kind='pf', bits=64).energy_model
+    new = lambda m: thermo.Cache(10**8, model.ensemble, directory=tmp_path, model=m)
+
+    first = [logq(s, new(energy_model), model) for s in SEQUENCES]
+    saved = sorted(tmp_path.glob('*.blk'))
+    assert saved and not list(tmp_path.glob('*.tmp'))
+
+    # a fresh cache on the same directory reads the saved records back instead of writing new ones
+    cache = new(energy_model)
+    assert cache.directory() == str(tmp_path)
+    assert np.allclose([logq(s, cache, model) for s in SEQUENCES], first, rtol=1e-12)
+    assert sorted(tmp_path.glob('*.blk')) == saved
+
+    # records are keyed by the model fingerprint, so other conditions do not reuse them
+    warm = Model(celsius=50)
+    warm_model = thermo.CachedModel(model=warm, kind='pf', bits=64).energy_model
+    assert warm_model.fingerprint() != energy_model.fingerprint()
+    hot = [logq(s, new(warm_model), warm) for s in SEQUENCES]
+    assert np.allclose(hot, [logq(s, 0, warm) for s in SEQUENCES], rtol=1e-10)
+    assert len(list(tmp_path.glob('*.blk'))) > len(saved)
+
+################################################################################
+
+def test_compressed_cache_round_trip():
+    model = Model()
+    plain, packed = (thermo.Cache(10**8, model.ensemble, compress=c) for c in (False, True))
+    assert packed.compressed() and not plain.compressed()
+    for s in SEQUENCES:
+        expect = logq(s, plain, model)
+        # computed and compressed, then read back from the compressed record
+        assert np.allclose([logq(s, packed, model) for _ in range(2)], expect, rtol=1e-12)
+    assert sorted(map(str, packed.keys())) == sorted(map(str, plain.keys()))
+    assert 0 < packed.limit.length < plain.limit.length
+
+################################################################################
+
+def test_cost_aware_cache_eviction():
+    model = Model()
+    rng = np.random.RandomState(0)
+    random_strand = lambda n: ''.join(rng.choice(list('ACGU'), n))
+    # per byte, a long strand takes much longer to compute than a short one
+    expensive, cheap = random_strand(300), [random_strand(20) for _ in range(8)]
+
+    sizes = {}
+    for s in [expensive] + cheap:
+        c = thermo.Cache(10**9, model.ensemble)
+        logq(s, c, model)
+        sizes[s] = c.limit.length
+    nbytes = sizes[expensive] + 2 * max(sizes[s] for s in cheap)
+
+    for kind, kept in [(thermo.Cache, False), (thermo.CostAwareCache, True)]:
+        cache = kind(nbytes, model.ensemble)
+        for s in [expensive] + cheap:
+            logq(s, cache, model)
+        # the least recently used record is the expensive one, but it is the last to be evicted by cost
+        assert cache.contains(RawComplex([expensive])) == kept
+        assert not all(cache.contains(RawComplex([s])) for s in cheap)
+
+################################################################################
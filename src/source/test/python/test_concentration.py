@@ -12,6 +12,51 @@ def test_convergence_for_design_cases(data=None):
         assert out.converged
 
 
+def test_sparse_solve_matches_dense():
+    # 20 strands with all monomers and dimers gives a sparse enough A to use the CSC solvers
+    rng = np.random.RandomState(0)
+    n = 20
+    indices = [[i] for i in range(n)] + [[i, j] for i in range(n) for j in range(i, n)]
+    logq = rng.uniform(0, 10, len(indices))
+    x0 = rng.uniform(1e-8, 1e-6, n)
+    A = np.zeros((len(indices), n))
+    for c, strands in enumerate(indices):
+        for s in strands:
+            A[c, s] += 1
+
+    for method in (1, 2):
+        options = nu.concentration.Options(method=method)
+        sparse = nu.concentration.solve_complexes(nu.Local(), indices, logq, x0, options, rotational_correction=False)
+        dense = nu.concentration.solve(A, np.log(x0), logq, options)
+        assert sparse.converged
+        assert np.allclose(sparse.solution, dense.solution, rtol=1e-6, atol=0)
+
+
+def test_duplicate_complexes_are_merged():
+    # the last two complexes have the same composition and share one row in the solver
+    A = np.array([[1, 0], [0, 1], [1, 1], [1, 1]], dtype=np.float64)
+    logq = np.array([0, 0, 10, 10 + np.log(3)])
+    logb = np.log([1e-6, 1e-6])
+    out = nu.concentration.solve(A, logb, logq)
+    assert np.isclose(out.solution[3], 3 * out.solution[2])
+    merged = nu.concentration.solve(A[:3], logb, np.array([0, 0, np.logaddexp(logq[2], logq[3])]))
+    assert np.isclose(out.solution[2] + out.solution[3], merged.solution[2])
+
+
+def test_solve_batch_matches_single_solves():
+    # titration of strand 1 against strand 0 with a heterodimer and homodimers
+    A = np.array([[1, 0], [0, 1], [1, 1], [2, 0], [0, 2]], dtype=np.float64)
+    logq = np.array([0, 0, 12, 4, 3], dtype=np.float64)
+    logb = np.log([[1e-6, x] for x in np.linspace(1e-7, 2e-6, 20)])
+
+    out = nu.concentration.solve_batch(A, logb, logq, threads=2)
+    assert len(out) == len(logb)
+    for o, b in zip(out, logb):
+        single = nu.concentration.solve(A, b, logq)
+        assert np.allclose(o.solution, single.solution, rtol=1e-6, atol=0)
+        assert np.allclose(o.solution @ A, np.exp(b), rtol=1e-6)
+
+
 # this is a base64 encoding of the zlib compressed bytestring of some hard cases for Concentration:
 # _DATA = base64.encode(zlib.compress(open('errors.json', 'rb').read()))
 _DATA = b'eJzsvcmSLLmxpvkqKVxnumAealfLegYKl9lXalOrXlRLSb17/58CMI8TJwYfzMx5rwQZDGZauJsCCoXOwz//zz/++z/+2x///Kf784/tx//2D0f9/OvPP/75O6jDwV4h+9MAfrDnW372PItbIe9/FjdBPuQs7sP2nmexD+RHzmIHyA+exZ7Yvu8szoD88VkcDvnTs/gK8rEs7T3k8xjoB3s+CfjH2D5dVp368w1tH7giIL9gw9/v+UB0PKgZvGLPuwF/BNun6yQ7/zwlMZ5a0feQj7pzR0nJ79d7iAb4ij3fAXx/bJ+ue979c6Ae9s2KnoX8+J07T99+v94XaPqv2PMvwM/G9uk2xgc/r6EwVnQs5K/u3Fea/rl21fdrPVYbeubdz0mMg/B8w30+AvInPOx2UHvr27tv8mY97DSj7jfuebI5+YmUPMm5fp+f5GBb8gw28h6yf/g1O+z5eWiPcs+TUH3Inm9d3Wu8j19qvSdGyh4GfoBd9cArd7JijxVg50F+zrrZUyd90BN3Ylxy/53v7H082EPz2G4forBDTI6dPa57Y/sQZna2l/lOn8FekJ/zk+ymEx8VxzjAy/zwVp+QGDvrxHvGq470rO+pjZ8KeQ/v44vk89fAj48mPEtth0eBT/S43qqlHR41OnjPj5D6a+JVB0RQ7pChu0G+W56cHYs9JoLyLeTDokb3cbVDIigv4iTvgP/bxKuuduhr4pInQv7gtr8gOjhX8S+B/sd/kLr+V+2XFGMovabefK/xzz/+yv4Scqqx5dJdCU7f+qv4S03J+eBSqj32wrN+iSn7VmKJoXkX+G656F9qDrmlqI8mPhcuvufuUus11+qrntV4yTEHPlRaKIlnWZ/LLnWXQ/CtDrju4luMzvmas4ueZ03Pckwt++wTLxnfdSGl3HsvLgsO3y0XPXF6pcux9QIMd3E+6ystCnwJMWd7qG30mEJtzvsYgj2rIeXqYow911KDt4fR95ZdD75E13JP49vaWvHCS++1xNSF4oubv/6KF1+qvh4qy2092rOgJYTYnQsh1NrsNTmV0LXtWHMvPs6FuZ5dTV5L0KLHw1DBWPE9CMGxjC04XpRdYAlZRzR3q637Wl1vfFJIjBMJQRtNOqRahLBSxlPhr4auU9GGXHNjd1Ffdino//SHiQZ9N3mQ7bLOq7X59VB0TsXppS3UEn7Bg5at1YWm3flekmhrrqS1UktJLna9tY9XpegL+4lJL2/zYYuuxiwyTSXFVq4vFspC665HvaMHbXX9ybeLF/IETO/Tl8AJROuS996JYtOgRl8uweciFOmMoghIz0LSB31LvviQejfU14swKQIQ9ptW0ECGr5eSqwigAT61OJ6JOqK2mmMRZYBIny696Sy01AxFtLE+3Sc99V3LLGl8VReyQaDCpTNa1LMWbRdZNCfCG68Lek/XC6PTzjjBoAskYtdVLODUPhe0vOZrSzmJvERzkF++CGITSrRe3Qt7X9ZlKSUH3V5dv3H58kX0kHWsoqwS5im7qtso0hXGnOu6OXy7X4TfUlwUZCc6AXK8dC/Iop7WtS5W6P3Fh5512LmFUJqxArEbp38Dx0mg6/iu91Bu0B2r3ghA3y0pCGTRcfhoRBe8MBOE96oTGcTdLqImL8ruObciLmHPfNET7aomV7J9DgTqUmSuvki493EeKQghhnotMg3EaAs5iS5ydMWuvD6XgxNErbE178t4n9AnPuA4qcq5BXdh9boNuk66xnEupVTdb118namB6BcRtk4tia9oLUZqwoDYchODKN7r23VgORSxZTsNnV8eZ167TiLoxGMLfi4vFB1GSHZ3q333ol3pegqlYsvBSFzv09r1o+uke2wsRxjV4QpVTchxvszroTsHA+d+d0OV4EpexNJhDG6g3oeLyC7rP6JpXSROqIhgurhm1QmLnTa7RWIAHiSL1eouJUNLc+IBTZgRygZzEAgxcp2tviza8qA0ankd5qEdC4KhJflLFuWJs3gvBhLZWpa4EnvUeUdtuHs/eWTXeySMJDWELlt0uug91evyiuO4Eo0OIszYJJs+7OwycH+zsBqMDxZ7pkNKEgSiot66CC5Mni1GXZII3XEpKtL2fzvErahVe9ZihV1RYUt//+URyz+Pfx7/PH7d46ua8vPro1/GwT5gYOVjtN73uD//4d+fSrrIPPjow1LovnpHuEgs+Fzh5+gFWgby+LMPSwz3hkJo+r3ejIIsFSRJeqIzSyhIsozHvEOmkURICaj4ca1D2rpHaatSUKRibMuTli5NXvLLSV6Hx+gdWYpaLvGNRrMeS0qjhshyk7zs10/3WqVIS1xLb3B1e4xGiWomtdSHtj3GPEKvRFX45MC+X6BUWu1UWJFanv14LKEsOS3jRZiRZhQBWcYCpfRKL9HqUQKuqEKBkZIrlUmHdwUpM0smbIqh+/YQBmUuRC9bJ0npksaQeEnnsfSUiBYns6WCKU44S0MVYtEbsqzHxkJEPNImnFbRpai6LGX8zfoi+l2TuYz+9cj6sJmzNMSgV4nieByMXotMVOnV+miVmlQHAkWwMjBlw+gopT2FOBbIKbgYeJO0YamEehz4NOasqFC2jfYImYTKLpvZSQ3qrlLZx0vyRYqpVFCU1STt0a/H0v5ZgRRU7ggrSTzuHcscVUrqV5oYlPWDYYqBlJs0dj1NIDDIftDepf9jOc93sGytVkqiTsjJbhmPg4wvmZXJodVjPOgKN45MqJY172EOOtM4TlJmnm6BNEOZwzIXUh4L4bHUYBmU4gWx1jRWMk8B01ean79yHtlgqOsiCdnIpa9Pi4/pxmhtEG6EEQQ2KWtHh6aziTLKStuohxV0rFWxHhAY+juuJgt88gfZhNpDECX4PtZhJ1aC7NcmkpLCreuqrRtGIA0nDiCAuq91fFoYkekkA0bPBJGnFWTLvBU9JFGOqIprE+xxhepE1zJ9xZjadgYy7jgZiLKuhfiL2EjiDmOvJrYIMUB/ujGidiFdFmRZn7YLzbK1T9lFg1o7viRp26Fk0aus3/GSIqVbRr5utehY1nQe625atzgGXEPqvbjaWLfHgSGjRXiW7SJDR48bLylRZMoqG6bNpIYqm1WWmV6qHRbZ8Auv2mLD86MTroO2jR8F6Ey0IwNObLONd0uGCN+yRorseN2mvm5Z5xKImWopssr82rxukizugoUp0ywPxBY7nAj6tKGOMGM7Mtl0y/R+8UYzo/TpPAiwwZIyvNEBMgxGL4qR1QMGdNkgQPt0xhelF8sYnFx3bEfmm8gEm1WWNidf5nZkSOGgkW3H47Fus+0TH8f82uRWdFj7ssg5ZxCLAJX1VLiOMon0vxAnVcnEkz2nT3dZ+mJNvLtxlrruwr5El85a3HdwtcalDElmZIDFbpspsvW0w4izjlfg6MEcl5zt+BDESVheyP/6v3/+8dO14ySAH+z5lp89z+Kna8dzP/edxU/XjiN/3p/FT9eOz9e6/89P144zgf907fg32vOB6Pjp2nEm8J+uHadt+Nk9P7Xen64dZwL/6dpx2oaP3fM36/3p2nEm8J+uHadt+NM935r7/szPf65+Ic98eFfID35r2hj/HnbVSZ7Io+znh/SwQ3f7Jfc8DvLnEmPnmrnvsX3GHdoT8rNof8QrdYwtue/+75FVp2H+c/n8Iil5AvCHdJJ9JMx/jc4Gx9vP+9z5RyJl+/zcB/l0H+AhCuHdfs/XeR93Q/t/jc4GB9/nG1+/qw9wZy1tf5/+YbfqqX2+fdV/pf4Ct37mZVGjPfwkD9L8UV7mc336t+z5SE/crex15zjG66IJd0iy/xr9Be4AexTkD4G/1LPu3lLhqZDDC/b8Af29xr99buzm/XLe1No3dwnOF0/JfIvZSitzuiTXm5WHk9QcR9ltyFSqlBhdbVZrXxuZ+ymk0ov30aoP9d0Qmis115DJ9R91+r3FRAJ+K7FagW2hxt/5SO16oECT79ZLrjEUfTF2appHrX0t3vUUcvepJ6t4zhfL8w+eZHBnFc+Z8vXUqGKl2pq0aWrtg3YWXE5k0tdRk64vpJar01+oQ58FxDF37d/rLyV010bRpHaWiqf2OOqvVlSsh61H9hZzJoH5fUG5E7RI4YP+G2JsZbzKBzLSk9Obqs95lS13vc1THR1dDiXP0v1CXnyIlG1QEr2q24XTXCLFuz35P9+XRFEVX7VPLYrSjVK8Vdj6UMikB9WxzN0GyvTJ7+46SldmSb2nkJY9Ca1bTX0vmZWEBpWAwV83G/XHSAW0DraVMrfVrCSgxU7jgtXOIGdfcs/U8ec0GjMANNQanFbsdOa9rsPIhVp2Cu57T2kW1DvRgItUPuhvJK+PZQS9pumYk3P0B7BK4HZxXXtJtqHcWh/FslbnL+RU55sV3vt2KVaXQVJ2mLXa2nMVVXY9E65nSfco8tYHU+2zNp0aHoouOvUoeZboCp1Bu6w0HKjjGS0cqpUV50FEIV+0lyzkUwxcx0oEIqUK4shId6t2WcdEKXS1XgujUNlR6RJiCdpdmzBE0TpSHaiusTWu0G4bVV2UuQjjYcN3d7pHpTWhfX1OmyidhH43KJMSYh03/RIaNWsTo8Knq7SLmPXMWp7XKkhp1z1yaRbEC8HB2gxw4dNYXuo5ZarwaaRRBwoEVEzHVx+0nTxKuqlM0y4oZAmjzUCkoqtUvUsUnEZbANolxMrF1B1uVoPdqAfQ60qvQtfAKNgrtC2g3KCOpYSL06XNVG97qipGU4VM74Pm9Fk6NsxmCVEXFpZXxPL6OHE903npLK12Y5C18BY6vEwUbFRtPQF0WcUGUqYxwGq0IDYrBlBLmX0HiiiI3TeQPZ8JLTpBsVNtMI0GD9CtqM9Kf7orrky0iBQbFezBjzJ0ex9VOTqlUnJMq6GAo2CcChxx21HCrvvcWhYEoTaOPhuU7+cWRT3iq8H4sacovgmqFycCO3y5XLjzXp8WQfo8OhmISmpMMNRSDUaMFwEVaqqVW5S5X5FcCZTCwOFHrw2aqjRvjT9E4v2nMP3n8c/jf+vHry78fsGvz2rNb638vvVppqmLCaKdX3xbBXu4SGhJ6EkwJrrfULXmv3xHkOIkYUVHFP+mlJmiYklDqRnlTWG7R7LTokpKyLVIOqBjUMHtrpXgBi/ShUiq+4cV878SqV5YafuC4HyzCppGyXTo6KBXgKhE6OcyYvrbsnupyJKclfLiX6qyMXcSZZfh+m59rqOfSlDqnx68XC7RW8qKc2N4W2FfMrqNJHFMb9EnPUQPE5Wrb8r0paNIDaCasKcr2Qj30jxQ+6U+fkxNNyywI5Grlbm+ORwpgdT3SrF2rb99t5PZKF2GjmwTg1IDAqaI8CXi9p/RdX0DUtpBky4rHfXtQtDtZEF6KpfX40SPLhpGQbVB70CVqZdgnbci5efSZ/wqIBZOvd4iBS5JR/SrUtisIBkwNMWRAbRKa7W2TN+1Sn8i64pQeEmiC1HCpKwUVg+Qekmlyld3N2Cd+FVXLJ2q0kBNK8phFoLL4JAxWVqlPU+3MtxMmXWiHVun0Rodq/wq2pUBJpUbQ032Q0hbYS3boG9ZdPrL3Ey8RCxpqWHa3+yJYFsP2CjQr7TWWOtaiFAtNXWYs71vdeq0ZpDGJqWWzlnaYubDuuc0ykO75DTWp6NsUanDfLRTOY3WWaXDChOOAlwptmEsQ7QaMBQSrZJytlrtbMW2IE8HKBWTCt31OEazK2TLekHsowYXexZOUehN0EbFbjD0ZZlRbEbnNpjAKG6WtaHjxU7X2/JatZR3qeLdinzt8aCckuBjWp5HaZ3os2YGgTZn/Fj5/1hgdg53gauilGrHa4iiOF9IcXg1XMlbewJK/7V4cSktJa0F6lkWUTbs7Lgq0j0t3XTmXoaueEAPA686yAZvtbpuQZm001kgddOi7ojBu6ghUEcvY9vRMyTW9W4dDTTp+FvJs9tCFrFS1ywmEnQdwlZJLwslcdO1vtRKXo9pkSi+2Okd0a09yKR4vTTSsRDDcS0kiU/S7EJ8g45WAyXpgjmt70ZRrG48l8lRYs5lsuZsND7oG6aS7pysw+Bo80BrBkSTzsx7YUK4Frlkv9Fa8DL0o7VBiSWm1bJBLAQnkbAuVlK3ZSdd0MR7RW0dTMX4U5V9Vi7kx3u+5WfPs/ipyn7u576z+KnKPvLn/Vn8VGV/vtb9f36qss8E/lOV/W+05wPR8VOVfSbwn6rs0zb87J6fWu9PVfaZwH+qsk/b8LF7/ma9P1XZZwL/qco+bcOf7vkMV9FNNsaJOsk+1VV7Qv76Zw/5fNwJf36f96w0unvPJ7l7d7Dc99MMzjjk95DPuMZf7fkMsF9B/hppL6rJeRjsQ5rB85t8Thvak8/8p6hofGmNXXgYzg7Y3mfDj0PeYf+HWLHnVsacXg30uMb2X68O6bPlnGhXfQr/BVbsuRVQp9chfbWKt5M3y8XlFqgh8OTvzYoeKgEq2eKBCQxU1iQGPeTeQnKlNcsW13dzJSmdmZI+hT4qf2rNMcZcmAloxQWlX3LvjRGYiSKcNCqJPNMvCtk7gm/VQJl6FkfVRC4xWhlMIfucdJvqSfkbo/oy6fs9MiGPT9ZRDZSiI7PJlTnMrbQLgwJait4lPwqYbPhaJ3WLepOQ56w0x8gCck+8zbCLo6ql0N6/565PVSZizGKg5hgCSkIXI+vG93PpnQwlqiPIL/q0MGjV0RQwxtgHT9nILKMpXrB7YThIabnPgpzG8BlGiPpeZ1GHaxRHaV/CYKqurimUW5WOZzQdr2uV+XlpFhQVvhQY8qi/zUWmlIDJ2NJc46w9cgxOKOTGuEAhxnzqW7U5H/ad3tYUzxYY9lF0Qr449vJNaZSN4ktUdNlhrxKgyqAKCjIqU0xGYZRe2RnxWVh0HdVCgVdWiIeJlbMCySfy92KvkaNx9ReMME4wlSzyERgK0ihYKBfS+iI5Tm6MlYyNaRckoFXhypc46hqCr71RExHjKInQV7WgVrpe18OYROjzBdpl+iiTgsakxHxhVEfWOXXLFBz1R4mFkvMp8hxTEevFCCE0am2s+CYwgLMwlZRMqnWAwTFIopOGVcMo7dDndDkYLgKUMffTXyJJXa3ZlBorQEqkCoYQC9Vna8mJ8ozInKmtpIRqD/IMmaVEWZlNOwwXSrPID9RfBs17d9GLmDxEYlqye+Qv4hogmRmkeW7XMc2JabctMnmnjfIbL7zkTvmeFj8nKjLS19uYlmIFiFS3NE/eFlNMw5wDmxj5Q25oZeKT7aNfqOxjsCMfDX7O33TFcUqVCUOGU0+1YSHZupBJaJUskYEy3DDRpM2GnGWAzGu1OioSSNtPicrP45/H/86PX10v8u7XJ+Uj29Q/ivQ8I4t6aHVM+6q/7e3G+hFxqTbGOP3+4eOGHT48XTFI7jF7mWKKt3UljH2v5Mm/HcpXO0PYO1qVb6tkBeHG9PPsU21WRlF2JS5pvRXNKtRV0lCtvj1LFQtoxnq8FcnY+G4tPddfSkgkTNgkheTjsfRdiSabr52r5Sdf33FPgYbAM9We0v0rniKYy6XYGK362M7BvU1sl9YR3LdTAH9ZyK+zLCn8JWE//Eo5FIE3ieI3MySloupkpdCgbc53o1uhASP0fbcE+UcQ9dFj2TCipmIT+SiqTyN3vF+YAZipVdBKst/OV0aBlKUgFVHq63XiXSdJXWaPFHhy5f9ew+N8aWTZe9AYtk3KvLJU+CI09ZmSL6MLpUuKh5Pm3VpYSfaFKZTVB6m3rYY59q1esDgSU8QZ3BbDtZSgJWmCjdnr1eb32UXwUiytnIZ53nUMPpOpFoULwXTWkiGuQi/ex3Rzm6K+Sh28KXdS/vU/Sm5GKUZCfdLX/ajOyVtdhMwrFhdRQPu1hgwrIXJRS2fy5TbGDQWdm8Qkxb6VrOgEdMlkEsngsPqbGGz+ob5MaU7N9III47IX6dreYwDacNQ4y1C09ZYCs0ATMwZt/Fy2oW8tcl7VCq9bXEUAYsBSzz0DxEOzAoM01l2ZSh91FFJ3ZyWQbE7aSDCSj0IoY+Q27g9GpPcwJN0x3m3UB2XmTzKSs1FwE8ZCgCiexezLhG7qf8oOfsoOvoW5G2p+yg6ehnkHan7KDg6G+cs//5QdnMlAf8oOzvz5KTu45+en7OAcbP+UHRwH+afsYD/s/JQdnIDkA/d864p+yg6OhvayPf+UHfyUHcyfPZMIv4F8aoLyp3s+KRf+49TssyD/DucV2D7PDfmpFfuidPQzDvzfvIzorr/uDXn//f9nKZ3acxV3QD7Fv31GNOU/XaHaYRGUG198gOV+yyuP8Uo989bnbMl7IT+y0h0g72rFPoztp30GD0DeKWp0+2v2tp8fe98evqEn7+oTccld+PNDfpLnIT/qAzxO9/vOct8X8sdvOxzynT6Dg7B9g4dmd8g3x2L3gny/t+IIbN/miTvUovoy2n+C/fyJV+poyL96XM+Oi14hn+ED+wDySZ6oj/d8NvCrV+qlez4V/qe0faJX6gxr/VbIZ3mlztCxH4F8pFfqDH/QU9g+wCt1hm/kPsjHe6XO8I08DnnPJTylGezklTrDK7Pbnp9a0T6Qn/NKneEPOhDbD3mlzvCN7Al5D6/UGb6RoyDft4QDrZubvVJneGVO2vM3KzoD8ndeqTP8QS/D9ideqTN8I+dBvs0rdYZv5DWQ3y/hZR4a/xrIb7xSZzuG/tz8JGc7Sa573iCf7ic522HwFeTD4X8F+RQ/ydnm3B2QD/OTnO2eeQTbe/tJznYY3AT5YD/J2S6puyHvuYSn6uj28JOc7Z55ds9PrWgfyE/4Sc52z+yP7fv9JGc7DHaA/LSf5GyX1M6Q71vCgbXAt/lJznbPHLvnb1Z0BuQv/SRnu2fOxvZHfpKzHQaHQ77BT3K2S+pUyO+X8ALIE/5rIL/xk7z9Ocln8kF91Un7/6C+6kTI78C+CPJ5OP8U8uGY/wryKR6az/b84c+uHppvX3yYh+ZrIEd6aG6Hs7eH5pZ3H+Oh+QLCwR6aG0Ed4KG59/X7eWgee+seHpoH3reTh2bHV97poXkS8hMemmde85yHZi9s3++heR7yox6ah9/xtIdml5c95KHZZxt3veEQyDe95yjIN3tojtjzNys6A/KXHprjIH/noTkH2x95aI6G/LmH5iDIN3hoTsD2Jx6aEyC/f/8LIE8or4H8m4fmVA/RL5BPzaT5xUPzuj2f5Kf4BvLh8L+CfKKf5NSY/62QD/aTnOQteBDbx/hJTvLN3Ar5FD/JSd6/RyDvuYSnZNV+fpKTrMgd9vzUivaB/LSf5CRvwSHYftRPcpJvZh/IO/lJTvL+7Q/5vvccqG/f4yc5yYo8fM/frOgMyDf4SU7yFrwA25/7SU7yzZwB+WY/yUnev7Mhv4fyMp+Bfw3k5Sd5QbnPnx/mk5y0/08hHw7/K8jH+wxONS3uhnyMz+BUE/JxbO/qMzjVJXQH5CN9Bqca7A9C3nMJD0LeAf7jkPfwGZxqWuwM+VGfwakm5FHYvtNncKpLaDfIz/kMTjXYD4F83xIOgXwT/KMg3+YzONW0OBXy5z6DU03I12D7N5/BqS6hkyB/5zM41WB/AeT3S3gB5An/NZCXz+Dts/P8Bx9Ugnzxr2dBPjHafyO0A6L9X7z14Gj/ZxCOj/bfAuSYaP/XLz4y2v/h60+J9n8L57Bo/+3v3jvaf+8r94v23/WyXaP9u6DxoWj/w5CfjvY/9o49ov3PY/vRaP8zkJ+L9j/wgp2i/U9i+4lo/5OQ73vJIZBvetVRkO+M9u+7529WdAbkG6L9R0C+Ldp/NLY/j/YfB/m7aP/ukG+O9h+K7S+j/YdCfg/iBZAnoNdA/shyP28Jn0I+3HnwzZ5P9Bncgu1jLPfPXn+85f4hqFMs92+hHWa5fwHhYMv9dzhnWe5f7/BIy/1GIAdY7ne9e1fL/fa37m25P//iRy33xyDvYbk/8LKdLPcn3/eE5f4w5Kct93vftJ/l/swrn7Pcd9jMg5b7LpBvesNRkO+33Hfc8zevPQPybZb77pBvttwPxfaXlvtBkG+w3PeFfI/lfhy2v7Pcj4P8/s0vs2I/mRd7NOQvLffxc6AV/Q3kA/X9WyGfaMW+BXiuFfvZVo+3Yn+Hc5YVu0E73Yr9cJ+nWLFfgzrSir0FwjFW7LfvPsyKffj1T1uxd71mVyv29lfubcU+9tY9rNh737SfFXvj+w6wYh948U5W7DNbes6KfRaZj1uxT0J+wop9fs/fvPAMyHdasXtBvt+KPQLbt1mx+0K+x4rdBfJDVuzu2L7Zit0d8vt3vgDyfPNrIH9nxR4bCP4K8rEBwlshn2vFHhsgvBvbp1ixxwa/v4f8Civ22BD0I7dqnyU8CHkH+I9DPtKKPTZAuA/kva3YYwOEO2N7Jyv22OD3s5CPsWKPDUHvf6tu/eIhkG/6+lGQn7Nijw0QngH5fiv22ADhqdi+2Yo9Nvh9LORHrdhjQ9Bn36rra18Aeb78NZBviMV++LOPdXsT5EPMnLv3vFvU7g7IOxu130M+yrq6D9t7WpeP0PY+R/0g5B3Q/jjkg+OSX+/5gb/uDfmAuOQtkI+JS96Lz/3ikre/fu+45LeQD4tL3oXSXeOSj0HYIy75zN6ei0s+DPnpuOQze/7mu2dAfigu+TzkR+OS+2L7nrjkXpDvj0s+CfmJuOSO2L4zLrkj5PdffwHk+ZLXQL7Hojs3Rvf2Z//o6K225Ov2vD/wWy26l+55Z/gP0vaJFt3+EeHHIZ9l0e0fNdsH8pEW3f4R4Z2xfYBFt38s+lnIx1t0+0cKD5HPu1p0+0eEj4K8n0W3f9TsDMjPWXT7R4RPxfZDFt3+sehjIe9h0e0fKXyBjXGnRbd/RPg1kG+26A5JOb3JxjgkQHlfdPB0G+OQYNmDkHeA/zjkU2yM/VWh3SAfZmPsb9rsj+29bYz9le0dIB9sY+xvzu0M+b7PHwL5pm8dBXknG2N/VegkyE/YGPubNmdj+34bY39l+3DIT9sY+5tzp0J+/7YXQJ7vfA3ke6JG289u9sbdOXG77f/unLgTIb8D+yLIe+L8Qcg7YP5xyGdFUG7f594RlK9ffGQE5QsgB0dQboRzQATl23cfFkH5DMLxEZRbQB0TQbnr9btGUB7Y2E4RlHsh7xdBeWDP33z9DMjPRVAehvx0BGUXbD8UQXkS8hMRlMcg7xFBeR7bj0ZQnof8/g0vgDzf8xrId1o3O1tXd0DeOYJzh3Xzuj3vpuM/BXkH+I9DPtHG2NnXvA/kg22MneNlO2P7GBtj59jRs5BPsTF2jtQdIjH2tjF2juAcBXlXG2NnX/MZkJ+2MXaOl52K7UdtjJ1jR8dC3snG2DlS9wKt934bY+cIzmsg32ZjHNUV8O44xm77fxDyDvAfh3y8vr2zWN4Z8jH69s7q11HY3lXf3tmc2g3ykfr2zsruIZDv+8ohkG/64lGQ99C3dxbLp0J+VN/eWf16Dbbv1Ld3NqdOgvycvr2zsvsCyO9f+ALI87WvgXynT9/tq3vfnb2zGzoeh3yil/lGaAd4mb9468Fe5s8gHO9lvgXIMV7mr198pJf5w9ef4mX+Fs5hXubb3723l/neXe3nZb4L8q5e5nv3/M0bzoD8tJf5Mch7eJmfx/ajXuZnID/nZX4A8k5e5iex/YSX+UnI71/yAsjzVa+BfL/Wu+cSHoS8g+L91J5P1LdvwfYxWu9nrz9e6/0Q1Cla77fQDtN6v4BwsNb7O5yztN6vd3ik1nsjkAO03rvevavWezvkvbXe+/D59RfPgLyH1vsA5J203iex/YTW+zDkp7XeeyHvp/U+g+3ntN5nIL//7ss0wId6mj4P+Qmtd/w8pYE+BfkpWbkP5BM1wLcAz9UAP9vq8Rrg73DO0gA3aKdrgB/u8xQN8GtQR2qAt0A4RgP89t2HaYB3YPWzr5wBeVcN8HbIe2uAj2F7Dw3wXsj7aYA3Qj5AA3wA2ztpgA9Afv+tF0Ce330N5Oc0wGcdkI9DftYxtQ/kczXAZx1TO2P7FA3wWafrs5BfoQE+6/rc/1bduoRDIN/0gaMgH6kBPuuYOgPy3hrgs46pU7G9kwb4rNP1WMjHaIDPuj7PvlXXL74A8vz6ayA/7QP88OdWzXAHyA+qCDvv+Q5v0W6Q71YIn4X8uGayJ7bv08z2p+1bj/oQyDeh/SjIB/vDvt7zN389A/IB/rBbIB/jD7sX2/v5w26HvLc/7FvIh/nD7sL2rv6wuyC//8ALIM+PvQbyftrQ6dHB7ecRr9w+etjr9vwI8H20oZfu+W74h9D2idrQI57IoyCfpQ094q05A/KR2tAjnshTsX2ANvSID/RYyMdrQ494qF4gn3fVhh7xRL4G8k7a0INhwh3k8+mRst9Rfbp8ftBJcwjkm+AfBfkU+fygc/8MyIfJ5wdDZqdie2/5/GAo5VjIB8vnB4N1Z98qt6d8fjAo+xrIB8Ru7pDVO8cx7tj/znGMEyG/A/siyPfh/BDIN2H+KMinxzHukNVnQD4ljnGHHnoqto+MY9yhAR8L+cQ4xh36ydm3yu2pGdwLeX7yNZB31QxO96xvP3d7DnbTDF635zvk44GQb4J/FOQT5fPdNs4ZkA+Wz3f7aU7F9jHy+W6fxbGQT5HPd3uIXiAx9pbPd3sOXgN5D/n8ePXN/nmAt+7/EMg3wT8K8vGy6kFn2EmQj5FVDzq3z8b2rrLqQXfr4ZCPlFUPOvRPhfz+Ky+APL/4Gsh7e5nvk1v7Z47fio6jIJ/rfbyPh58B+Xjv4336yanYPsz7eJ9mdCzks7yP98mts2+V201iPAB5fvg1kA+IS96xhEMg3yS0DtzzuZGyb7F9WLzqQ8inxKt+B3VWvOpraEfGqz6DfHy86h2cE+NVXwA8OF71/VaPilfdAnl+5jWQD5MY4+cb7n0g5G/o7AzIJ3LPtwDP5Z6fbfV47vk7nLO45wbtdO754T5P4Z6fYvjt8xdAnn99DeQjuef3iu9RkL9XiM6AfC73/F4hOhXbp3DP75X9YyG/gnt+r3Kffavc4dzzeyXwNZAP1j0//Lly1cMhf3q9Tt2zfwHkD5jpsZC/utXnYfs9Vzubtv3hnORb/B+ph32D8zMgn27RbT8fa4Nn8LDX7flj4Gdwkpfu+QP4L6DtEznJxxrwayCfwkk+Ne0Op+1X+Ibeofp02v5UOXgB5Pn8NZBP17d/ofNTdc+zvI+/o/pEyO/Avgjye5y/APL859dAPvFWna4NbT8fSKyTbtXr9vyBM/Jl53wWbX/AzI6F/JWX+2yfgTvpnL/yBL4G8rmawfszP9tDcxa2P4P8Cr+ne418Hj/hZZCnZvICyHPnr4EMwv8l0P/4j3/8tz/++VfJl9xczr2kHGMJ6c8//ir+kmJJofXYcuo+8ixckiu5lVx8S87zuVovqdWQg88u+O6ynuVy8aXkqsex19YC322XkF3VN2vT01j4br6E0vQ4Nud7z3wup0uuPoTWem4h2bNSLsWV7mJPqeRQJly9qLSYU6kupjDWV5Kr1bVQei0NGEWfy/qXknpMTX/UM6ftllr1KPXaW27JHoZSSxRYr/X1HuN46IIWHbWQGlwxMDysMYbooyuuFvbsLu7tL33G+SoEVFdCyNmn5MfTqNf4nrzzUaj2bb4vphpd9Dm4lmJey2mt1ZaS00Z7nN/3yUVXe9HJpDQW7lxOMWg1+m+IsZVwXUbQyZbighBVsk7JHgpQ6UKpDrNm5+emQnHOhS5wPfo64PkQs3YhSKF778fKwK8T7sGA/hDm0ryvWpQOI+p8Y4tvcOGqFw61hFai1l79m79V16sACCfV+xTKeCriEzzXQy76Y2y/o1gEJax2raLr/cEopV6gzy5cpJi6Vmyf68KtgJYQRb6G3VAvzQuy1qIDzIbcJuIRobcWY/J6DG690BJ7SA3KLjF0nvWL1qRrUp2uQG7A8OHSheVSRbg9p/lV8O6E4dy0x7GU1nX4sSURWnHJlhIEQlfACe1OBBFtG/rH4DjNmvT/cxucoU8iOoEFTbFedGm1Nh+LHT5gdX9yqnp3cyIQO7EGBOHD6VxFxHZ/sjCgDTXtXYfdxnfLJQUfuCW5QuK2FJ1qiV7EE4WpMDClO6sVxhZ0BOA9lEsTjmsPWjZXcmxC5wqxNk6/VPtmjb7pXuiwq8DyLCbRI3jXdvXELor3urVac/Ywnxr5XL/oeJp9PfbJaWIQp+n6nK6Yrn30A/FeR111Z3XzjeL7hX13cShdGnGpZsvT2qsQLl4g9BgJJDEkLaSLEXqRnR8ISDopMUb9IWuZfXxXd053OQnHtdkF0mHUlKHg5Lltn5yF0C7KExmINwqGYymx6/JpuUYrWimv81mvEwELd9q/EZmOwnOAemNpybhvv8QKw0uiOVEf1+Sv0HTfxEU6+68DqohM/BCqFhP0sfK5kmBuurWwSp0cQLU63Xex465HyQggpAt8TMcozC0AoWSnw9ACxcnL+CYcEhQLpAhrAtXVSa2IKESnHGKIIm0YrE4/IiEgRWE9izXoJIKXLDBstkvU+QdRfwh2htwT1+zoswSJbV9vq+KSEjz6qHDpx0q0OO3HaWVzdTmKdppLLcPC9Ua+a0IPeu0iiiF89F19U8TQQ3SpTHmkRUFz+s+UR1pc1i3WiYllSVwCNtmliEEUIKof55+8Ll5LIQpKEKsZjMdJgnkYrBcHNZy4C+Tf4Vx94k7H78WKK+dXJ8WmcJF40t0U8XfR/zwdkThvWqfjOS99q2i3Wppd7CACEyfXNc5V301t0GtALAahUlzH6FpMQUjUciUAOTa7E04UK5koTiOu702o6sqmBn/yCCn9bewCAa3jFs8OJoM+PAvtwkmsdV+vrEJYEYKaCFtr8WLhfFfMUrKkcR3XWnTdQ+gRgl1Kyf/4X//P//xf//P//f/GzpFhYggeXpTquL0i8RxyBbcu5MGsKrJKL/eLGsTAtR0TQkjEOr7bmy5S0gogRHsmDumcsAtxioUbxUUnOm9FCsyVkvqF6yjy8iy9ze/myG2QuoQwHixXpKQbqFucRSOpT2GiI2jAbdKFFgMTqiX1dfgSHhxWEI/UWYolag+GHn0RQpPCkUQdwpwBFaK7qE+CSqzErrRYS4fhiHFJgBptQUe6Rtwtyc7JNCVEGyci3UJCzY8twBt05lUXoBQ/pIboQLJRWtG6vv0iMnbwAnE530yoiy9LT+lgylQaP4kGhOiNwutgpGJf0jkl8yWcymBV+qpWK0mvO6njNdGcL92EX9EzEXfqg6bFF5H2QoAO1ugowpcRftIt9F4+pysiGtRRSdY7ZNa4cQ2NTJ9CEyn945PgdToxSXq/LUVsCIFTG8rWZE18runwM6qdVpMGQUk/EP9OEqmCPsS6UKl9IUakY/W0rpJuhzQ3cfCahtwQ/0WrjaIUsehNRiTElRR3rWCyP7EuXWxpeBVAYxs6BjFxqAwWMr6LYhHsIIX8Pi6QXiSJpbVIvRkakPiaLqZ0ZJ2itIAhiBrcUaoZ1N7j/K7eIwYueYQG2QfryPpa070a4n5e0ihaTF070a0a+oRITAoC11QHnqdQkM4kbRbe1gabgCkmkznc5BiGeBYZCp6kSYGfzguUpaBKIxELFTbauC1aLaJCN2T7bhcdSp8SYuMQqPqqjleCSMrxUjxg91q/mCei04/tmoIiESny5QrmcWGQV3qbBPI0SSQrPfxeZIpybO8TNcu86JLNumAim6nd6TVavvSq4OJEiy6dDBVow0HoQ1XAPqnin6xnUIbHkIBGxVhKn1SaUYB02QTCmWDQaQRdDt3A7N206D46DUlyNOikO5DRbvIEC6mVuY0yqQUurlcWOKdZYNpZ181ytjHnl55/5dJv+LXemWFXqP0R9BpwM/AyekTAcBu3WqwE5VAsV7rVEBheUhpNQlpptI/phMVIkNG6sdIo03iWENqiR6fbZYo06gt3FUtXKCtTZ5RMltSXAJASUweVizjg9l10L9E52SSWqpQhWVxpsHDw5XXBpeyLlJLd9HTRfXEwA5Gfc32qPlq+OIdYSplCLmI2FQi9eN27AcNdhGRJ4AInkt4+bqH+TXsV8XPKdSowXBcxsKY1DzGGKoEU7lithqpu5iFQxSbQTadmJmQU4wASbnVQfhLL1LfFs/o4TlG5roY0fS1QVv76rvRZqXpSVzbUS4UXD9NHRaZauW3NG7fDeNIV07WY0k4yXaYvTHUY4zHqUueKNeRlf8bFh8RMxIZD7mWq6x+ehtiANDNsBAmuPiRlR+BieAnLxjvF7kUTUjGlDqXBXvRV6atcK4cNiQbzhjLLBW1XtrdMrY4mbS+RohwQo9LUJv3LXEfjlXwE4ePeSWhxaA4E2ZUVEqU6Nown0UibWonuv+hHfEdX2QQ1AkP/FMXxi/ZThijUjetNt1vnK4Y+5F6GDMTKJZRF21OIOFQzacfiey6NLSCNxE90i7VgQ7UYVONsRZO+pWmSBtiLQyD1XNaKZbSJlWMN+mwXU+QhOYCg6ibSp2lk+qiQgPQxi4zdIo0dlDktZp2JxwVScCNIPs7vYu3peujKifeFKQuFPn1Q38P3Yd8Vq+TC6Fi17mH0oKM0WQIijuIn0xIrlm0kE01sIpShwHSRvolumTTDyyPdT2uTmlJwbmU/LnpCrEiZM5OxzoMU12jYdpuGy21wKCCS3sJh+Ow0ECuygcRzYJkul8kkpIcJNboUUJEdh9h1k9Tz2JepT2aiSyBt3uluSXaO/UqedzQp/e4+zduqvcvwFR7EbOtUsERg8BuHy6ZOhiCzQOTT3WYh6WbKFu4mCKWEjPeJUUpRF/PAZmhTARSwgl9Ddn5pZRqSOhkBgN3VWqaG5bKWMu7gtKS8CQwdJfeh27nJCtF6hfvObRS+5z4cNInTyQ1+L+VROpwQoq+Jw8WBA8+lEA6yKXZlnKUEJexEhyHdK07StQskHJch+WGAOosGaeUyjQs99KBeNIOBkQeqglGixLDZhOOOe5RGTCyte6gD3GcdWheNTiOx4f3AoSdtSAfv6mRiUhEcap3oaloFogsxFnjf1GmkXFRoGKZS5h4qJmdHh8BwNuEt/i9mKN1K9Kf/89O6wqUme0AKc8ifHgWeDtRIz5VxA6qpIJihV4NQC5YyE2zJzg1uiuJdEBVSBkxv5xm6OASedYlgBVN4yFCQWSEoPrWl5sgIEBUUJI0JlIiQ0clLTjScj9MEMu9kwBeJw2usGT+IPiqGOTmQMOUTfAktSaspY7+IY26bTMohyMQenIgmZLMg0pQ7eiD60rmKrU0PU9R7pfMU0ysGjjFz8GDimbG7bIJXV77pBJEn03mIuBLXlzAQEsKUbI2liuAdesmfpq6Km4uSpMDqvpiFrfuDVVVlJ8vUGDjWmcnydTyAsU28NxCA1S4tdFkFnuXqeGR8+DDxZGwGoBDWEiQBg0IGGnrisrNQCIRKCbG8LUUnKuHQo5R+0404H5Q6LBHcdNOLFdBuGmoAzt2he3T8tuabFdVPJEv7EYZlgos51vDpWUioS7MUm17mog5DTLpXKCNMbqsjw1oR9cn4aGn4NuyIxI704bBEpMhOWrlEpBT31qb2i8KdLdIwvbGy7vRnh7DSKdbJQ3WXMj7g2HCcj2c4WLRiDP+0VAppzabe1OHFKQi+DDqglqlCipNx+gWn8nQKdVQb2fZRJCBmNDm8TlViCbMIR3sZ3y3c9kR4RKucVyrj6ZVZLRy0IZiLOANCWvqrpGKbn5Ps1+knnDgtTEnV0aYK91S6UZgc1KOo6iRLHNKwYAMKaoPFIcUnBrRxvKLYAGlgAFvSe5QGJFqdCkaVxRXMdyvETLg6Au1Bxy0ZNjEqwpMAg1naKeIvwXASr5TNs0EVxxfmIk79GJf1jb6LDqR739cu9ECsN+CAc+2L00giM916WGYa11sCFU2gmzox7BVdZKkBIveMz2xayynIBqsWbxpi3nwXUiEyQqVO5dghq2FO0ijElIyvSsRJB8O2MHlRpmh9bxkjlvWlWNzVIYnlLl1HTDTj8nRzG9IroiFlhE14nY4VX7dEhgihDHFmO5CtI8tt0o/Ho6UFisYb8bUJViIOf4vudjWnka6ouE8oaxdpXG9cLSIL6RFlKoBIVu0iwt7zchFpYRjjXRdorUXfdbzfcxmCn+6ghDNX/9qwCydb4UpJzkpI8PhPM9eiuctEPfiKuh0b/NjhXEW7CeOruhXNoitx8O4ug6sQGul4dJoJFuxGojT4QyQozZBFGEZv4Q0hpU6aktDLhFEyXrM6pbekmxijyEXryZ8dhslWU3GwRst050rj5o34tKdnBfLGA1cRaWX5w9DKJAp0y0UH46LhPtJBJlRKZ0YT+ouMHn0bNNexW9zzGN6ShcsT7LkGGAAeBTJObSgSocqoUXC6uVuiIVJFZazZLrCjPDEoKUTcuLFgkQSaRrIY2QxdoOSLNpuFkZaPQgq85HIg/NCmRUd4S5AxJdt0YEZ83j6aMza4weElUPHdOxzuva7gWtW1QOUXXwlTkYC7i4EivvO6QLwME1z2zjDY8RiLU6DCa9muD+pG55G2plc6N+Bi7ItaHK5OaZJ+6OcFz0VA9+kzkJKyMErQK/vrWswu0AbgXD7MYFAl9C1+h2BKUx3QHcD3LSG53D4fHAavs8BsE/WkwbzNmEbHJTY31TrxZIvf4YLvQwZJG2rNTHWhBobOiqVxiX04XLiyedJ0gSAJCmcd/TRTZWYkZ6H4upx6RReNKAdXEj1wyRvcBsgzgEz5Le1cd71GYoVhxs08brm3wXidJMHKFkgYmJoO4pv4dcQ6jAY24oHSldRedblGzFGaiYxZiV9RKj6otrhjRT0TXxF1m10PWvTNBPOe4bqEH1J8wmJEM1dALIkwtd7Z4UJDLHV8pzpa/GQyw2Z4QfQpPUl4kCDy87te+jkuJAcvCeOG48Wu7Y0RGRrhXod9bIH0OqRBzqZmWwjVz0BZwzddcQjEEe2UIeOIV0odChh15m4Q6iVcG+w3sfMvjiNzuhEX48i1iBnDSGxFKkWfHvQsmpdCheKUVqyvS62SuJKaIJPPEjcu4pwSb/ifap6KcjLDn8gIGDDzSWJTJ00KhdRLMc0yEF9RMeEicTIW86lL5WzxqrLqkYeda5tiCdM/ABuXUVPwMQ+fDTfIY7wXo6sw1K5KYI60ENT5NNULKc66Ezhz9NT8zrhSxLy0ey1ohIC5QtxaaA0P4WBA+Dw7SlGr06iSdYfnweNYSDMLRDdXuECVEm1LpRyZBhnPrISIxIEb/ng8sToZhAQOwuW8rKSioChIY3Mj/qLtk+2BO0vgh3YiEiHLQkIJ22MyIKEk4sFubUjcj05DR4vgK4XUBeh+XCtdbi7LSLqZxpIudsZVTmzXSE+UgpuRuCiiaCVMkB+jC65LlYZgEunBqiWcJDdWnEo8GH2toU2KD00mV9EmJdTC1LuMLUuQigxwA5X5MaNEXLNXjBKKl8i1NQ/DQOIF61SqlCdQPy99IxtIZGHSc64ki7Sbca7BazCrRRHdFHKdfB2bkK3gEGsBF+a0UCoaEabbsI3h02iNulUdDXzZNiI4ghlbIFPbciSUeMuZimXqidIRQUnZ/AVEbnQU5BFhboYZyg2EGSxmlOImWrR2EYpDVRoBIwlcoU5MteaJEhiS+DviCsfjpwcRyT0AvyTRpGWkikwEQgvCGlpGULaIoRRDnHO2M6EW3QLDXxxppOQEjl+HC3coQ1U2PylRxUSSUDCERjRgHSQGuSXdjIsrYdYJ7RIbMc9PtkQA4yO5YIUPpqdrI5lE8gUGzbiQolbyzVxKg63oXjRukHQWAJhOqDsvKaB7opMt2GtTzGlbxHPbkjeS1nhDxRxETn44zqSvaLX690DQPNtdzpUYITdWHCeM2JUoNBA8KbDqPAI3nAaUjspuovdPi/sT9sVthgfEDJKE4yxi3+oh3vOx3YYXRW+QYTXUuARvFY9DN64jwBBFabjhxRvisvqQSlKkyMHQ9fGfIh4Okk1FaDN0ItyZDkZiTiVfwZ6RD5Zw62F8tRkuEjyi9IEkDs7njYfcYj+I02K+tpGMg/pVMDnEYnuc6naFy8tCEN+ZNo0Wmsl4g157HMaK9PcqfbHB18Qnp49OcjLhLBSbHAFe7qZUNDE6ndJMiyDUJU0D1TrLCiq/uvKR8zK0dTGwVodnivi3MEQqFrs1Byh2fwUL018Zp95QEapkR8rCnR7BDP/Ey6aLb8qoDNpsqUtvNHlzJDTU9gJfz/O7DoUFrV00yuo/DIx5y1nECBCPmClhkZxF2R4Vtd2VifDfn/FdMTJokozJdU3N+0VmoNSfoU+hS5ChIEITc7F96EqSdoeZh/t9etMsBAKLkEkyQ+oiyBR1nBJdfupnImXxRX3So/JsLgzddSLbkNEIR5Hf2SwXievnl2ASKWfi2qR5hjQ5v8TIL85nSFJKsKyUnubdgCAw4XV4nhWOJDNPUilkT/CpD04aiBolPI9iJ+ZkTByH+IBRDZ7MT0Uz6jTKrPiFKWJFpE5iprnNtIe4FDthoBDH634yh98lc47mmRDTI74V/RZ4N1tW3EzCatxTM8h4zIbbyBTVyYpNmcmNlRuH/Nc2Cy4V0TNGkd1PkpCw3DjiNvwuEX8kxh8hizS0NjLeCgkN6Sphk86ykH6L8u2XbUXQzkdcQ24LvUtOdDgJDkhjpboxGZ8AkYRJ9Tpxh8gkXTalJTu1V/0LMbkyOR8ahhRlogAWPE6TqzuYAlbKdE5kcVfL0JCWRsw7DcoQeTnky2YdRHyjmBH6dlsx8EDsyJGQJgUvT7gFjqX7XU0BK5+wNx2c9pFEC2noFPZdT6grOEuPq3HGfgM2vnAnWg2muWYcnME4uBY5kqhkbJCVY7mAlsMxpTY5w9zXDIecvJEvkVyKsjYV6whTJ9eZvKPpGMK3R1JLWj4GEjplwEvyRNKfbc0kJeIuJcYBx5zZILJS8OnrpuWR0SGhrUsk4STrWX8Zp0vAOBo6ceAuBdwiMlKF1/Fa2AQvIvp8CFvYJAVLkRF5xDZ9RZaXE/Du5WvijOQwOWLEoqZ8qgTJtReH76CUN9IGPargDp7vi5aTavlvM09I4lX7LZbnUPNgnMONZRHNK7Mq5FpixIU2GfsFd5yMP/F7IcpPJV8v7rgupFmNfFBuh/SpZJninN9gpp4EFJyG6A/DyyDlqZKVgTLnl5cBW6sTYNKJu2nvk1hKHkMj5WcoH6QJoUS3KFG3EkelF+Vq+SZ5eLUl71hZg5Q5jrFm8d9M/lPHsxsGsyc1piISC+Cn8RwtS1gnGaZiJdzjUQlwZzTWqUNEPKFk6Fdyxv+ceYIyQS19aK7lI/Gva04YkyQ2J7o2LpRxl8iGM6sp55XHaPot5nhZxQEYMOLhngxS8rf+HIkBYhyFDFK005GJIyRzWUjyluQf0R3dO+eIj+KEGNHMrsPExUf+TBqJBqjwJIJ3BPlMUyMMhvaG+58kILu+mSA5NCr2pQs3vFyWxUZERUxicF1cx6R7wEikuwyPkf5VMEgCgUsbSgWCa0C4v0zVl7CIGL/YMLkpg3TNY90x6SC4caO1FKnLMZuFKdLvn2lZXjSJ3qP7q2MbER+OSDIHVb/1CVd0r31SHKGr48IgXRPjPJGWOa6guJ+MUxz+JGWPEgfSdANiazC/PK8H+fw4WjDy7TiKZWZWy0F5k/OMo408xbZ8Mp6U8Y5zSNxIvHwmcJLAIFY90/zX1R8h07S5wOsF8SKowxe0vkuuimwRYuym+yXLWSCqeJUUhKm6CRTtT6AmniOcigguFTB1SBTJThf6m2Dth9osMWI8mCxuBgijDhNFnfoCNwSP1DJSi8U8MYPiMmPE3uDgsN6RTFQs16yjqOEjC8tnqzskjUSaRhke9Wbhf/5XVwayKbW65bpwAdfWoFFvmZp4uPR48BuCbyL5itkxDCrLhdf7I95Y3bCZkYYhliwNocbJc/XdSD4EObI9z/CLWGbFw04avUV9zFAilC6iFBvv02/4m9ovnoETlyjP5p0V8sRzSTONVjkzw9+WSmuJUzlMPkxyEUnAEmzOp6F+4KmLGPOi1GlEl5EOH8hDoPZg4gUzm/wRkUCd4VWr+5A00GUaYSQCEiSnYABIIdoygAnviHlaJc/iI2IPonfCwUM+VWqq7B51wjDG0yQTZGoLxYVki7jiaI40zIyqOpVkYySkbHUU79IntZBsLRGhax2Hl/4jswnDn+IkSqhGqjB0RiUGuohlqk2WQU4wgkJCb3qqcI/Bv7S/ZhyN/Fxi5pUMSVHHzJ+2zHcBIBlmcE0dENFf3C94zyalmR8S7x/ID8NEQ6ngPqFb5WGmSzOgTEQSVprAlvE77TrBnqVryfLAOzEohIydEKYDNobkMNVBpnVHThJ1oqOWrewqcQVH9RKOJyPcD+zLvzKhoCipRowvjDh5IWGVBGJCOn7ccByqpJvKpBLznBwXVyzJ55xEt1zuN7YfruqCEmKpFDUPNYQspLTl5oRBrniKPRIk+bCqZoJxK48zeTwLqAhoB+6qmsAocMcRlNRBLtKUuEso4Cy0989s04IhkEjnyiPrnDsn20byhzDqYAAfPbM8cQ4Uz1tJK+eGNETvUaLRixbJQdZuBBPmRcwJyVOuhR6yEEVaptYRCF76ULSUy6uajR/HgtyiS5w3Q0eKhOZEgt4SaU0f0h3OOLDjGyP+A+cBSWpkHYmJJQovxlf1NVzV4jAz4CWWIGHFKeh9ZLjbUmTgZpIzC5birJvTPzhir8UqJ2Z8r5r2oXtIol6b5lGziihHOUWyWxIJHFABRD0CbvZJ1dAARuIysAOx1ojdjRvRmw1L3iW1EkKEiGbYplpgBB9WBEMy8Z8fO0sSuEftXG7jP4d+GvE4UsbU/bQ+KGEK5tt3A2wiB0p3C1u3rkt8IabezDyUMuBG4K5lsoLNEeZnCRDOWqlkgpA3j5CZ0/qWbsZKhGuoL8K6DshqEIZVVjBbGxe+DRH/octHr6udG0M1wggdkD4K160kSrjJYwiQJ4zISEpMm0RKYip2PFnSMc6TlE6Mp7pYsrMtT4clpZPMtYb3YpwkJRl6hGhJs5gxUYYoFcHYe53RejsitN8Z0gYrUmID3g6ipn9+7LjS+egJ8s5Z0p9xu0x1SCEMSN3oSkeq5LO+jTBUUr4k7oV2Y5ZmK+i6UK6UIUutaRC4TAAtjWiXw0s26CfCfxA+BM1mgKpQKUdiMjlJnznWJKetTCeT+NeNoybTo3CbUyzbwzQVSL6UpSaWL3NycGNKQESgyGo/coVIXiSTspPiRI7Un2bVo1ZpGxYDMiLQYUgUU4grPbINx1AhWITlF9O1DOoDv58EjdQFK/GUVRLnTUPlDJZYvurbcOWQd9+JNQ7tCr+L1ZNdX/eW8f7uUHzz19Cshkys0LS4MNm8VGkdLXW9U3W2ikTy1dubK3lBU6ue61vjyEiStS4xiW2HHuHdShB8574cVjOplJRBEAcb+6hko6FKbAGUovuMe4XUvZkUUcn7c0R4yWOx3M/PiwUwcUhX122yWE345BnxO9x3nQLFYUq+ecsTXtRfC80Sacxm6PbhiCT07kBjN2toVns73POOwmsZvDJkB7rhEnjeC9zcTRZTKEkXQZADZsa4zhsVU3RdSEdqwy+FCk2xD/FpaSgU8f9vRxW/9m11IJQXOMnT9LcY0p9//Dz+efzz+IWP37Ut+Pn18+vn18+vn18/v35+/fz6+fXz6+fXz6+fXz+/fn4d+st8Ze9cZVRqeX814Ck9pNQTJ2/+za7P1Hb0d4+JRuYWfv00rbzwjKe6HlfrHtZIpCSG8fu7CTvUt4+txohgzy8fJvbhCPO3+ttCcPa/ezV15FRu5rAthDZStK0kxyzE7dOOJjyhhNGebPs0mTtWvtio/r1+mhZSjhSs4MoVJIEdi+ImQoTXldCkMQYKdWt/g8BAH59G14ue5gLTxYqfUkr46oXvv/8iBkFdQaDRgsVM9E/bAjPlFgSAyR16+246jxE/IbHszWOyN8h7eIM/ug+QPNoyjYSuWyfLpNP+iCys9Zi8KE+LsNboC3fduvWdIcak7W/roDUTyTEkLJX2htKiRfdwrce3R0Y+LqURpKWG60uok6A5haPv4ptPE83zVJW+PXerv86jv8uViqtWSAov68jbQmgpFap1PcjC4JvdkIXZs+Vyv1mfIx3C6wX+SgukuTlHzUAK/krwndw3avaSK9uLiydDljz6VGJs43GjrilYLg9ue8fj+ucfxL1FL+YaJ4XOj8cexziVFNSsEljR48LjaL0+nHV5YN8EgiL5NIF2P3QOKNA7zvlMBRP/ofKB/ITxjkA4uvHfXOjZqWOMtmxPIbnhmpgu+Eh//lHIt7FKaevS0uJaSIJUQ/C0wBBRjMeU+pGlRzqSF2WP9VHiESnApQCbpJ1tj5Q3OzKFaTSYxzvKJZN3QO4KJTF8mnBkunTLHCMAQ9SjjPWRjmZNKSr1v7a8yofpUurpx5Lprwmpdlse3TUIniQ7ej2OPKbIgt5hndzBMNfXKZ1y1n+V7mZlOxpREtkhpNJEMVKtL9iyaalBgwKK0kJanyZcKsZFegWZKAt/hdwdiv0CjNiPTUaC9h2ckgDYHMeeOTJLHLEKGVKi+3iJtW10NO2MjWYi2jxJUoXkXG99QSnRMUwZSGqaM/X9ZM6kvB0ZdV8p0iJWF7ItDHqrjhKnFBKCEXfjMRVxtC6m94uri4gJR+VMEqkYj3+zdXFISq51p+0g4zhIugCJv5BLk8oiNALBZKrQnFZ/GS8J3Ec6wzQyW1OBpOzdjWraSg8GT17SOkkPOy1kfhTB7Wt9zpqOEcEj7SqOlfQLWYO6HkISXSIEkvga14m8HKpYLAN4gRT2UqHpQEO2cO5GrhxsZim0z4Dz03cgWCiVbqykeQTYS7DLR7qddVck6opUIRzrKRSytZAVXmIaJ2mPY4CRNmvyNlbSiCKTGW7x3BLaWiBN6MirIyEj2wINg6R0d+uoSpsgPR1cqhoFWk9Vn/x6B5l+jsx52vAVfToZ7ZCqE0nfJSUV1sr6qnU2bPS04DaAQI6SKrdOVxAqGHVOQmAeHIasK/gLKU68e2xSF4eqHEp4spFlZNUUX5B+S3s21ANWnanQIliJShOgbFgXpx6tqyVVcM6uXreNiyd46zIUqDEd3Iiqd7K2OwkMeptWlybHJS3VU0Mr1lDHuyu5YfpohLRJpBnvZiFkSNI2xdOFVi/pY4tcRlqb0Y0tLd5KYk6wvH0KtcO47YVYuEOFotGBM07CEBsSXnwhUm+pgHngiSh0pQzW+lr6ydKIVxfHoXQyG8NgRjR/1Gtho3q1bquW18YxihGXTNPODqnyYpLdyKv1JDpIeUmLWdKQgKYrVGQ5uEuyM6elg5UIEB5GMgVbR7YkNjG0SJF5HlfM9FJKS6lChl5T4YSLsRJPFyMrSIdx5k0gJirjqXW0jI1BmBRxUj9MpjAd2QZjpA8D7ezo1N4pml2ch5ysZq3eafdWFy+h3pW4OYUKY+neWExtlnYuzktC4sYvSbLk3GhFkupijIGkd24leXBIT+P+xdq8UxuDwl0W44bBSXeg8TMNgder2Xql40ymxZIWEk2WwevIh4okoKa5SW/l+L6QHZpEmXGJJ6pIxcqpaJC6kQeHhkzIcyEH1ZImx0FEzgDGQ4235OImx1u37MBkbbfLlWFW619EwgQMaewykVtCMwZvu5pCn+oDOp90kndrsLMxVmd1rrpinmbu6JxsUtRdUDKs/wE1EuPTFLLQ3z2M3oG1rvXR850cHbp5mGozT9JZmZBVjPQybw7VK9J5rd85dQ5p8CNrSiiprPsngVjt6hgBklEDRSQkEvoHWT8cJVlAllsvssjbURo7h/+TUxXGuyn1phicWh/U8T52KXTnSIWH6fGlzU9TVKY90ikKTXUdJfXTntxlkTgZY1P2ZbL00W5or49xsRgm+7B2t6Q4oztUYxuRvGEnrpalCNoJx4EqGnqi4ej2wwpookpKbkMDDhRANh/WherYGXTuzJZ9P9ZNrRCpIJFcVXHpuGS2peLTZILEej+FSKEzrmlNARMl93VzWIgUHBq11qG1G0GQPmkF7pQ1maQ0KUwrQ3p7MltAyFwYpBkN+e+CoWPe1AQGOzCMgS5ExqaRF50jFv8LlHVhE63tUHoTaCvcrcRqvKSQEEPXcg4e1XjgpF1GXy1auGmX2CbIEQl+lJWSLA8s17TOEtGZ6IdAiib3b1xiz6Ebn6LDZ1m7jEhr03bphFEXsTl6UZF0TpZsiOuSoFqSge5p6glOoh8SFMuEVF36uIeNb5iWhoEstOeN+USy55FFdDR118dUp0TMMFJEw8CgFoiR39Dg6BfUFoe1LnLYPhS0+bDOkgaUJA0GDKK67bJQW6L/0lAzpLCOgRYy3fNyEUzdOKyjcw1FoRRIt42qIq2evFUr9fkKCuXpBEIduMin13UI2AoIOfoJezT68Mt4BZqX0t6a/gmUwWhbOQxFMVL+Lt5O9mJajDlYn8+SYLg5LI2/mQVLGiWtdYaGR2U9nS/puQcrGzploMqKxjjwVDqSjAVZr2+M40yH98QyBmlZYyc4VoNR6NU5TkFAJ0+zuzoHOniNtH3Yqd5LNV8f+LKKb4qXsC1pw6GXtGG0FhrfItf1FbieEQurZTbHqO286pSWu0cHPUqppuaCHcpQCsoLGi0Oxi69zUkpVP4w8CT4jWHhYPHFUuCbiSTTnJ1l05M+S8+uPs4A4UiVE1MMKD4Lgy2TWEwetOxHVo3tBgbFIxsdaCjMqMhYvWReN1qt0ORE7NNeYkcGPmjETcu6BjMcL6H/mBUO0ACvbxik9hDhZSV4SNjkh+pMjwmKOlj+VNbjhVa7NKpjHERbgld2obRK+rmjkJlHK487i1DDnqCwlYsf7UpkCofxDdGBk8frGDCgreyYm66X1GFFRkZqGAFEmGE08gnFFGx8fNn077ASD5t1oqW8ADegWV/dfAXi9VavoctOsb5kSuTTZrhiUjAcAzW8mIVJN3L6qaUOVafxGHOF/HtJz6WMtkEsKOcyEKz5BXo/8kovkWpBExaoo7nt3dnGtljb6WZ2YPfDp0cxa6JVohimMFDtXiVr+olRMQwkXi0dTVyZ/oDm4NDy+rC9KEMhK5QqCd5c41D/ap/FKsnUv/EOiSRaAAVr9cxmqhviNDBPgSbKoF17tKtpSdHkZ9OpGDVguGCc6Y+08sLp2MdLSF0ms9nx3wJWu6nJkf5feK4oa77K9UafFlF9o3GRn94der1Yf1OrBuq8uttCyBC3D4t6Gpyv2rud1YdSMRCpYVzvNmFP8xrk3tok42Ssltb6TxeYQRsahsMokSqBx4D7MDaZKOpu2Myeko9FDbTlI+OfNj2I9dbHOYpgTD4EStrHOcJ+yL7GV4qova4P/zAdv+GD7KZPZiU9J9poI9rSj5PkluTA7evkgfeFKJxApdoAlLc6OJWJ9OrSKWLVLpnUmNgg7YT+tC225WrR6oyzSVmhdeLmgYF505ILe8DcOH74ayplJqQR62ymIiGLB89Qt+ZsfXhKjS5lLjd2TiE3OsqwGRF2OJO1EtKtl8Ajj5huInS5i6a65OGhTNZnWMJX1JKHZiCLokPplEo4b25f8xdWvDoyB3A1b9pFsKFH9GClI47L8zGdUsCHN1FpLuUwkK31FlqEm2WT10KY3xBqsDaaNWyOwWR14hy6Y1jQWB9NUxhc1UzXtmszVhLJ/9ZGE/d97Z1hEM06NXh6NW7qMP2DoG0tMRtPH0cD58ukEdParJeFPzLokdf03c6pLKcjMtVZ6TbtX/o4SJqrBNLVM112zD8+tp6sXMYqfVrbKEqLoGchRQ+VWx3DOEfH8CEKUCXh/fKRUPnlJRTpfOTadEVaG3gUb3ECjCE/8CTZQiUBjWQirtW+XoK+T+cp+rzmmjfnIt54cR5dNOYmDSlnzXqp56ARl/Y4xG2iXy8+b5ry01F8CCJKwDO1eEyoQocYmgnOY299CsxwMseCPaYdjUlbBD8cN/pxjsFmGYid0AZ6KE6UONvcForE6VIw1Juui0oFIvUh9MyJS5rh6sNxUKxzZhjvpkYC/xJN8+nAG4d6Y+Md6KJN7wDcFuMl9KzMnrEnKKIoVMMIEjElbj9BBNfLGycYHrNuPea4CGnYdJJHFEgwr8d8EDGMx5Ro0l0iTleVuWsaNQqORFlWuGmYrZvaSckoBcQD3bSIzrQZp1o8jWUP7xN+GsbQUIeC+pXH4RDLsL7GIvkwVSRbYLY5G1QtGRMwXVdXv1iBYyQSE5a+kin3hOnoFRVtcuhwBD8y3jycuojUQcbRinFo006frk0/7Mg9tFIiV1iu2ewunPpN9x+Xqz2eign1zFbhjzcjL/sFnYNwU5Z9EBFOeXiCdGU6+ietxUyHy0OUEU2gvxca+WKXCXoNuJy7ib3pPkg0xaY6y6bprHtjnSCJSTZDzLggxUIguLqoXtC9HywNukQftUBPzlcmKiwzMYWGEsOuHp5SqdGYBBRA+NqXvUR7ExRsGhHEutnVjLXShSTclhzKeLITo4cWfpJixaVleXxoc4Hfgxbp5uD1Fl4BZzyly5ZBNGFD68fRqpZRVlOnpQKJ5gBMEGCEUFufpg9vxW8eEM9+2aGmI8LAdMhmm48jGPMcAEol3Gb6jnaGEE5hHtpm+tI+E2mDRwirILbBRQkcdnwqHNBm/RVKTvGEFHzWywinIQAcnl7Vfluf9HAkGeE2Xdk4zBM6XVpJnU927nkhCr8p/ax1QnCf8RhFlBZnVgZPZPN6kihLTNupCNbtJPFUgVNKLfMmm+hHih5m/fPDPEn008q0OZp60J58YQo3pIgJLZwBAxu6redQxFsl0ReXg81ZjI2pW1hEccmsBAumGznGn0Ulh4HnLApPU9celmCmhpCaaRwBuKfzcikw5sMqJj3Ff3mxEiHZBjwUm2K2+TPpu++ZG8G4h6vXiFb8RKx0Nmmhj0AdkUbrZu/iIrQ42rYTjw7mBxkS38rFaTSo324Fp2hWaT00UCkkl7fATaX2L45Wu8Ftcg9tEVaJvHdtk+2YdcQdsCkz8Zxoej+tLTD5qJqOfnNbYqOCVSjfXJ/Tzycej35KQZerdfNmcrhUZ+LUeaMXUnQduCUM0SvLEQkpiJ6scmxE503DQt5UvCuUudYlJelZTX8E+m+4npfyUTGQ6G+XjPPPLUrP6zYohKLVtDwDqGFgn0Cyz30dF3wIvd9ZnVtdb6ZBfTKnrLDkp+hMNIOhgQpdWQgbrMtkzf9owCg2ktPGcfFBNmvxDFltGp2rRtMEG7MFuIZayPkWm/5B/5hwpWzrSeGtEeTVz8UUTJqM43XwefPMYotEzOiOx/Cq4MNw6b1DMXcfp04jKfSWbJXNvdXFAxDeeJ/RIKvbLjvGL9TUedq3MHxAg8JjQlKBvcREPh1jmKOJbt2XJurH5BIKZOlZsdTFYv0oisVysHg3lZiYAx3AiZ+NSILdUwaFUb5IrWgqdb2kJGu+SuX2MPWjoQR/A1NAerLGQYvQkuV5WHfsPGyeMqIoxKijddToZXM/YxyYwUeRcs2Lv7C/Zr05aHiy0Ta8vVlLKJqXhxVJYKZmgpAp6waxQ53oqFyS4GTGxLZ5Sem+Yl5FaVghz4AikXgGmlS2Gi3sHM0XnIwOMFm8mZJDUtgQNRQ1a4G5sVwbuEZRuyNQ7Vc0mgQXa0BrQYNNAlvncpocVMzotCKviTQXOqSiNvShFFOcTGdl6tRpsjj1bfQG3hqYdEN3ki2SZa5Fekcx24LNmDpmmoS3EuJiqSdhBkCyyTdPkkOMy3cWaEZBiyHaUbi64qMyQnEtWH+LwEtin95HGpZibuBLWJHhyuALYgz0KCsbddtsJh1+xYUW/HJNseo8uyJYpspwYdLAig5hRSC7+fzsJehuXAUDyuGkOLz6WEj6DuOGe1mmCQNPiWiAP2fbMa5B+wMyPsQKmkX5B2ckAYlm1FID6Ts8iJ7H9ItEfw1Dc5ipArgH05gY082xbeyfyT+d/r60eIJzD1cvfWGZXspVqcGvs0QXy4wuspy1LbSebKqLty6fiMNkLj9vcW5nbSssC8a0Szz01taq0SDlamwwaIe+G9YsKC01iIg4t0FmSzIX8DT/vbXMoA8H2XSbUoK5Ru8YHZ1lbIXxaWKldPSniU5Pi9E7Yt0Om83mRWyaV8ZAZUol4nxj3dZCgjBRtYE929nYKNAM/hj/tWIoNvjXmjrG0FcsQooaI7LQ7zPt+sPKQjC1l7wH2aAj08ziSuTKYc8z9iOULc2EwVikneDUhfEMQ4t/obky0zYGzzCx1ckzyJbvF4drYbyDsnikkOR7W0k9zJQhLsOUSbToaf/TWw4nDib95MVtHBl6Vya9yC9WzIgTE2Z0viAoObbIQWJ7WpeIPNQx4104f2mGayNXLRI4guJ0sLS5IfQ5b1uOBGSTgzFYv4KPhdZywUZ/m/UZrxogC8a3GEem2XAz4XYjx47GlGkKRPK+pLRZ/wEU/b7UxYDAQ2e1sM8WcKcxIKO6sSksQSmOd3vrZiSdEaU4LqlaYQtkM4mBj5yFOvMB6JnOuIC0/Ezm4/Zo/pbY4uNi55bthvvDJpv0N59m4hXYFoPZ9EjfzF1DAkswljZs9GaDF4kdMHUgbZzOjLqOk0zHs+lHmfZ45CjatEO/rB7RHc2bkcDVXdfNpJ4+elpwG9ZLaMpFig9zhNu6H7TSGl5EPUvm95+5KtncrTLP6Qrml1DFt8EcXjqJJr9lztEhnf4u9Ca2C7yOkkAAaZE4WTehauE/oiHI4hDWu8EfPeToS1/K1NvzmEteg0U3R/LsMOIIvNJUkQ4tbvNdMoLT04Aj0+F/WuPaDiO8iUk4ayU4LHp6hlUmNxFK9+ZqjyN3hLBgtQ+LpQhkGc5fvFKVmFceUcNYpzpPC3Hak2GUjnsmxHobYU1uCqrGYFP4W3BVVcaONMsNGsLMEdphYpbkkedWjtQbEsq6zVMhClVW3gM+i878Tlg9XDfbyeNX7uidEKw5NZsxgki0jIQNlBm/eUZxMQmvgSxGDKJs8Q7re2KT1dEZy3gJU1kZr2jpgNLU+hB9NIqmHYeNOuyWljcSH8g1S4w0ZUS1RQZN50EvInpAyGvIfUNVselcDIOkZfTVo1uTtY/BjVngJuvQJERGRxtvCRvRsobEcKB3BtUUS4P0w31E5nVlIoQNO15nSbIkkTtctCNybbfB0rmw7hInPTY5I7SBxlvdYl7Z1MzhnkL9pd1KxeRvfbE8cgJoZkc8LZn2aZ8uTHq2MW0wsc1Yl7FP4BmmIs3omqca2kidJh9mewf9Oztt0OmJue438whJ9nJDTTCrcoWYeRGjlr01wbL3r9XQ3YuERtwsYemadMijrSsJA8WSPkf8pJHTS0TExp8N4Z0JhFkegs1tSXFtqWOnk6hO6qjzK1DrsHSsazFtO9bVtzbg9D21PufzHdfwuNBJf0J6j6Ijmdti+LJZTiP72Hm46DgSG/dt0zwIwW4nkkktNDcOgwc2+uCIcHMydTiUJX/pqRbov8TQHvv0Ek7kR7tknpwtvdfRAJwkQBJ0gl92DD28iZ/RXtE8dUuLDAxhYooDjtqlqRAt4qLiEPErZYsFYqniFiHnaotrcDeoaqAlWVspDEbX2HUOvWQTLEhP+pPTIEhqfejLe05qUrFUz0pW3SKlZO7PMb3ckglnpplj8C7hY6Y+bdKTbslMNMdpZfEi34a8oZM7AQtSY9NVV6HPP1yY1NpNWaEGhMZDTEoYRtIM4JMATdop3HseGn2BrHOziac475w9JXpro91yKEtnIi7qbF6VR8f5e/lcma9GEQNZKm2uTyoqTsNoackw7zd+Fdx32LR01xoVEkzwzha+pgGdVUgMCrTRNLSGonWlT1fN0PKRyXcUs+jL8Si0mX6abOhaWrnXphYRZmduF5ga8tCEKgFqBqLYSkZ4zmGw0YOxFzNJk0UlujVUpfNTJwl3S0wjRx3vhafZKQHz4csJ1sGagWoMzBkvQWbhO/OkMGN+rqwQgp7F2tpZ6tyWhlKSzYMyZdlSUUdaFe0hGXxAPPRNZIOWT2TVVcvmH2+OqDBE50iIASNlhNHFZU1n539+YptOcMgszJY2wsBDdtITVitxdM500GUZKZqJmQqSOMyuhtdMPo7rxHRlyk/CQhRKSWIMiZkXWyqvxyFng6BGqsC4fIUQUsB/WZNb5RA2ixb3E+OydUf83zMRjpgBzikSF0Yu2MiSgnJkF9LNqsapBkXzuXZrRUca6ub8AG+WdpkqfpTxblg4rdji6D+IVBqcnXGPKF6BHr11emgL8ztt/iQJsK3kzTXabRAxYt/Z+Y4YAclyXCYIfETi0nB9M4weiwzLqm67JDLQg8W7as/LbmRWeKSlPOkIRtwjrwTdAowgNet2KbNN/GBYcZnOpuE7CzaTkD57aNLjKImmkPluXfKGf3XILwuiYyuQ/HMVvUI26gs9IM0FbyqT2CTdHBmJQfLvkgqQOY3byVB1cboFmJc7htfQeioZlzLbibAQiUlc6rgSitHpCjMA0Ma573/PDG5G9Uqt9BYrXSYLLXa1FiYaMSirbi/BD4RHV9JmJvfYp0ldkuhDDwh1+ZDxh9vkFpJCYflL4sDhmMtW6Aq88lAJnka2Y12C02ZkMi3LdH+b3nldCIMzjJskEsI3TNHei5wNiNhy3Qc/R6HzmImxj5TLIYQbozwZkVKGHj4dfsZFScrK03Y39ZwB3FSTOXLpllMuW8NaG9LnaIYY1lEyxKzhGSZQv5WTWMg0mqnZh3wvw4lM0J6u0db+dttksSgQCh39wZdPKVtSO8NFGdS6WZm67Q6TzLwzy9kpLkqTMtKjneX/L1OQGeSiQNF2aO2qO9iALkjFmrvGTZAzTYCbRiZrWb7EPAKZJBfNcLx5/RFVjfyvnvt2r+n16WxkHZ313EoUpcloh4yhE+hwS2dgoixNF3GU17y4AJ4dK69EhWxb7IoAH4EAnC7m4QltOGNRKAhUoCZt+bqV9FjmMmTLwt3QnbwN5RTvGkWDM4ulE8GuY65uqJtlwuQOHY0ng335g2jT6VDlyT0gQH5lU4SQUEGtM+c1tQ5SQ2KbFbdUNX2TpvAed6elAKQ8tsOQUGdpgrlvWXFMHs0j2upyb4tMsCLpgJm7FRqtuxAYnYSKRdqLMfrhkSTcAyup1q9y2Y29W/lBNanWl4lUyNCxIDFR/b48A0gaDA/kTsl5cYfmzNCvYyJtXq82Pb3A48XvwFQaBWTkbFglmzUZXT7GBC9LqJ8czuZfpe9pH4PF07hQdWiB9POmEgFtL1yviBWJUhuQe18fTgyXJiiWcar5lSTZu+UN65NWqbmoGzfEqOyxPK11s6k1I5uaRM6YpkOtXfAsExtpY4juSqiRntFtpl6deV7TWLDsHfroUpq25fDY9+leK8Zj7w5D4OAFK5iXmFObaYGw7+RQoO6XjZmgvDSMCGIiqa4rgiVvCabm7d7UVJo/eisNzbO0tI2USlhDI4sJpWh5cywuQVodXbDTxKBl8dDH1uPu8KUvbmeNxjPMwMaHLf6AWcIsKlyjJdXlU8OiTeicvo+I8iqPxIBk0ASZcVvE0eixkdaQ/KqDLAyV0AlTyEeexiYpyRHpjGv1Nr/771XiwFQyJrt75MVWx9eiNQJnRF23OPMK4VB52LqFsVYMO0Gv5DqQGCK1e2OCdkVsbCxMrIxNUsJIgDkwND0NcTZyPBgRL/6HWpb65q8zp0chl4y705aeD4lFuh2TwJlWCjDphS1bLls19j94Hfl7BGoyrquRNZTNRITWiRWMWpVRaEdJGpyx55GHMeptawLTzYbVh403JCRHJFeF7LW0AGaCsLj+mQKCeRxGZihGqfXMbsPtOnRXupuStM4oYaPKbIE75mI6cr5h3ebwa9N9TmEDTV1Jjt48kiTVc5LilhnbpIysTvxjKEnkwfblI6ITNwIcQenbVC+nGyCYc4NoD5HhGRyrVi9LDjlVsUO167MyitKoZvp73DTSxExXLNlEwteWsWjTuu0eULvV/p41cajEtKkNNimyb3cE49CmZ5KiMV9y9VhEy9uU3tIto6n45UAoluoMFFwmm8uiEAYkLs5Ao+iX7oLHJVmwl+s4XS5kdpN0TYYb+YTXYmeSEnRnbYqZ23gtAdBmRXbo7ZubmFAiOpQVBG0UTWm1brL4GGVIYQUNujPmhmuCvtGL3WA0ZTwLzQ79qqSM+AK5OqmmxW5INA02rpwwSB9skulwBAFkkRUz69YtJw5AyYl12ndbxSVBfsZn0pd3cx4z/IaUdM+M5W4ybPAbwujoLYGcLThInIULTPKTQUpiNzyhjMxcZykWOJzN8zlSZrCbcT0lfPZhS1wiCsAnoeButDjSNfIwfav5IzfmFCzwEzwjo33dgpWMS7QwJdLGrtfUuQptcMGAyWkWooNknKpVyDYSzJcekc2SxRPCpMg+bPmI68RKE0h+N1MquZlUwczZSqpK98tW5t7Sj9gabLe6+XDILSYuTE7UvM6k7FNlkq0PeVzugEi7DaZXYf7iwVqWnjZmczVEwM2tHBNthjJpPD6dJhxtcBAzXJ2VAZPDHabtRr9gRlszmN7NWrJRaUIs0FnkJpnNOYpbCPCQ28ER12siEnM0SZOlSUNZAR2qdak+soK0Gq6ViCT/iHiso4NbOT2d+g78Means2DWKHAlpcB8ypSZlbS5ER1jwrC5rZPBdlOpLaPnOwLLb/ojXjFv0+Aasfhx3fGzOMoKGU7s8/IXktSNnO9MvfQW8BzO9MBCoAWJiuY2VDUCksS+Qhtu/WkHkY0IGyC3oi1PWkpWlS9TjAYd87ozdYRgJSnkJGhuvu5mvi5iZRDV5NjZ/ARjNocPbtW6dZmAjfGalSqRa5admIq3lMbYhvQZeVXMWyQBi6yKeM1tQ8/2BCNYXV6XncQij/MvciHCUpU8FbnGX+n1HN/kQVt/FazdUKbDpzEWD1HemGmQLRAzkkxkGnVG2/U2EqiGjw4bxbQtXC15xn4w9arVA8iaDcZc02pAQEYfQQrm0qyXZHrxm/5tKZlj3VPijfglaUmYiDPsvpUxe7NYmA/mql8JO9ST6/YUS9pcJXyU0JoRSIIAE6mWsc+gJAbj4X3YanZNhOjrxDj7ZicwRtw0SOypsnW8kNosqsBrQwf7N05kypLNw91WsbvNo5BexcgROiD45a8ixm36UjNn+dWLQLZBt8Yoqc1o3i9xAcKidCmwSMs1Usd8XUoWyTJLM7oDsWOHepsQUad5tvBM9h5lMDENVXgLJSDMuL9tqasWSiCFGR8GdVpDkNmLpLmRtg7/T2+KSikuJ0eEhAvtcLs5lNllol7FEtG2NDmqGB1JJm3UT5Yy1DxvLBOXhUVahvsTZpGcFW4zcnu5uyibQ3lsdWRutn/93z//+D//+O+0Y/onGFw//rd/OOrnX3/+8c/fQR0O9grZnwbwgz3f8rPnWdwKef+zuAnyIWdxH7b3PIt9ID9yFjtAfvAs9sT2fWdxBuSPz+JwyJ+exVeQj2Vp7yGfx0A/2PNJwD/G9umy6tSfb2j7wBUB+QUb/n7PB6LjQc3gFXveDfgj2D5dJ9n55ymJ8dSKvod81J07Skp+v95DNMBX7PkO4Ptj+3Td8+6fA/Wwb1b0LOTH79x5+vb79b5A03/Fnn8Bfja2T7cxPvh5DYWxomMhf3XnvtL0z7Wrvl7r8Rrgcbv9jrYPgvzdfT7J9XmfFXvwOR+61S/P+QQD7zdZ5X//+3E/d/tJDrOrnnnxc1rvvhi+n2/vvoR7IN8O/ACt9/ltP4TtL950ouX+DC521YYe2/PTWu9ukuw839ATe96Zq+/giTvXij0xOvgY8P04yS2vP9Fb8Q7mKyDfB/8or9S/mSfuMMv99qt2mJ/kxPjzjcBP8ZN8ve1zvVLjJxy+5y92e2Lk+z3MF+z5Fz5zEuQPpMoL/GHrnJmd9x8ka/1VO91ZqFSmY1Qhl+2vHC7MXqLGx3pUdj0r8ULLmU7nCepoop7VSqdCasmcntg3Iy3b6AbEDItKot1fhRaPNNYKVM04g1AppYlkKhbmINnHHG2UKJb3Nl6t8DrrKO5bouY5Bbon/9WsVyYrLoWJO22CpWEFlVOpe0oi/ir1wj8ypSXrOVlufzlytslnDFZLGWoaD+ls0TpdE3JNzttDMrtpQUsLIlqj5PHROMZoOAafVDe/z8wi76zqiN7v4/uezkqdonay/tP4KKPVmK/GnAHmMgxYjHyj2xSlnIWOE/b9ShkGPdIT3XHB0ahZb0xbYKoP3bj/8jaNhj6AZPqlqm9btqC9gkmGlGnR4cmluTGXE/2yHCmUdBMGq8nqt8gtpJN+CobVC21GhatM88bew/g643fIx6Q0h8bH8ymFKiBX9KK3DFD0WKJ5BRVqKaU1JGetr9Bwl9ozRx3TxAXJ9FZY2IRfZ2ij86qVh9KLizTr+XJa5VKFSNuneT50lbC+NYwg0Kmnt9j4/UA8fTKzaIzGA3SQ5BlzN1qyHnQ0gQVa1LqohiM321NFOj4XRNXemq7qPDk2bw2uKU5PtAVpeTyzlv3J078sOT4XadtJh1NRKJn8drg0jqYdEkUMZLrrWYg0j6MWyWedlX2sXCjGiSShMgjAtsElZvoPdTRCVRtbq+TINlr6UYRmSKDjrnX6dAx58rZf2iyO0RE03zLy05eLvkRpeqbXYxtAqA3VrdUOmbg4PicU1UY6bODqjc/pH4Ulcr+54+NzIVEYwLRL0uQH/kgup6qowy7AaaBVGT25k03lcgaXEq7YmQ5h5WiDDK20LNogMdq55bnj7CjesjZneS4wWdfLTk9NbWcA6RQBFSsqm4epzzU6mHSKQ8u4Wcx/Ym4KPQR6yX1ursIaKNKmDGW8j5le3np+M4WDZyJZ2kJY3TIFeXNz2XCnY9G3gRGomLXmutSBukUwuTdPI9FiEwkGIdCCkq5x3rou8LlsXa796Pdb4yQi7pIvNoUpeSO2zLgcHSMDtaIRBxgw6mASEszPhqm6bZoqc+JowpVHu0Ikx8/jn8c/j1/3+NXjlp/+9WZes5USRptgMHpPrY+92/t1/K+YrvipOD11WtchvYGa8OzhbKNp63hsPQaQwa2WNZTWxkFby2TqItKbl0iLzDZNki5e13HBYuVeGgR1KuU6JZraJbFkCnPSGBE7H9NTj46KEm/x7afRFG3cl7/OHKa5HpWdpi7m6wDgbL2P6HnQraiWx4WWGckGMVsHhdm+SMoC9R50rrKWft+QFOKFsjyJqRL9t59mrp+OiO511qpsPqYDKf1npF6F6/Dj2ujj4ihXLDZNaW3SOm5R0zTG1m2jiCWbPUUvs2/fPMpowx1omNreLJApNnRxsU5rbz6dGLLgaDrtr9OPK7NQpNfTFdGGL27Trek4R7UUszCvjzFUcrAxwPk6/5h2VZTgdMr333yY8QvaDmp5uD5msF4ZhU5XiDQEoMEpBlR5M0vcOloWWq9JcXyDEkbpsn9KgiZI+sVZy2p6xURrGzGnn9AlDaWT0X/hu5O09jN0frVBuesxzY+Ya0QTaOvz5EcXbqp6aEXlrC3neNwp4KSVIUXNwToB+zBqfz0GFvvU7rcBw1SUUVhFxz1/nd/r6LSd6IaVg9VkjkrISr26dOogPW40b3ZW0kTd6SjUTnk1cKd7AM0Qu64PdZNbpyfaPtFu1o/O7n/PYmxsj8ToIUZnp7oq/JgJT4MAEXdq8zol7Br6sGp5dMSpq7k0lqdUeuZWM3FgHQItY2Rrebqwv2l6ZzXy1gkRPTSvqwr5JqwuOiwZQ7L5J4Le6ayaU7xOaIYAi/XVt5nY4Tq4mWJeL1WUItAw+9u2C9apDW4v3SYajwmltHqgR0ml3fis06RtJI2cPOWRpa3+kAwnsJ6T1GGXuE4XlFEcV8xWzQscPS6Z10BnkLxGufTLaDzjrUubtUcbfdM5cQr/aceaV5NOBhjGaAXS3RoqL6R26zhvneTHDILR5IlRMBRTMpO29NUHwVkfnG5jE22022zbxMnSnopW8KWtGkCbKGAN2JkmWVePus5ICmQInZhDXUPPYrZ5X8yUcTbEwa9pnhJbdOFnWsfW0oJ+L0yrjUz0sGmwo8VaoLtEo8OO7CMbJ/FTJfdTJfclzN1Q81Ml9zTMO1DzUyV3MMxf/vmnSu5MBvpTJXfmz0+V3D0//wa5OWft+bBszvOA/1TJnbbhZ/f81Hp/quTOBP5TJXfaho/d8zfr/amSOxP4T5XcaRv+YM//f3tnshw5jqTh+zxFWZ07aVgcW9/mOcbq2Dav0GZj/e7z/QAZkrJCKUUkI7hIVVGqTIgB+O8rHKTTn3dIdJT6vDUZ/ry86hOe5ElHnytksetFydWqGp638m2TfJHKwPdj1co1JLdx+7anytdc+UmAf7XyL8h5Yhb7kPXXzJ8fnFet5tUPXbd1J8+ffSp17673d1ZeKcd44j26zy/++Mz9PthrZDd3rLxSRve727WHnNBsUT11QzBZbeWbfeszzgCvj5+sSu7DlbeoJHrR/K9ePaUKqN71Vw2DRyGTFXXjUqei2lxhfBQ36S3uqpgJMVkvL1BdlEvqO62mE67qkX5rk96Xr9YeauI+6qeinrBU1zp1HPG9tKaoCMSrc7MewRvrJjepeZd6O+hl9XrMP6sVgg+hpapHZOP4ZtQDgupzrpIhG99UOyG9Tl4zdooL1KlFuFoSu5zcXNTUckotqUWI1/OrtY+qsWPRI17B9za7fbAFvT5fPdab963ONTtMrv5savfRfBwVP2rLKpJqb9Xrf64S8lnPraolb/OqAxkTxdxUmKJ+DqmX+fzQC9XVCTvqeSx1dxkXliyG5qKan1jTUltVTE1dgtqD5RZ+XhKio17qD7JyKcjSw5wpqPWK2jTUQUgW19roAep8G/MHPViqboJqrNwW3oXoRnNaPVDYC6cupUnXSrJUH9Ufeu0PGULtqCArTa/512Oaeth2XrDqWWKv1gzR5TqjRBvUAVPdtJsKVkbdDFwzdZuPXk95+jfIfZvUlzBJD1T/tJTfhNGrOkolbS5zKnrG1qnrZhxjpsbj6uGZUcrUlU2VLGqKLkrUTni+TiVerqmDsx4PHDVNuaipVnJ6hrBXmo3r9AiuHm4MIcx1TjBHLSANtYq9+gag6k+vXiRc3CtjQlKb7d7AQlVWg5Y69W6xMalW0c96FHrnb8RZ1A2lF7PNBVZifCphXMjCehpcFYyIOfcSP69eTDX3p4XVc9vPQCBFDzGruVvXwSjxqFOQV3EQlik7732pvVcrVNVA5XldnEjVw7RqkJBHeZCpnK31RkmWbbHCnAKyB5AeDu+lkr0DgWdO9ZEdnsOrUV1QR6iih0MtLUVDWTVlpT9UP1dspaSyTrUuQp42F0mp4ohvtqT+dAOxuh2qxVBGF/KoS1JLg4oPghcx9eIiFcbpMXY9maoeG0PxAq4kqaMKGultqTNN6u1c1BUqdRGHrA5EeogbM4PRkoipS2x0vcWr2kAMt6EH1NWaT0QbHu67hOl7+Ht4z8NbVyDd9ONVudK1mqSE31MTOXWxTdpGLL0q31ycrzOkXR39/MW9sfYtc3x6aqfN0tVr/UuBjFcxvjokEVVelZpEdg3qHdOcSisuwxZ7szD587bUUcVJIU7bUOtteVdUMpuIT2yA1dMzz5VbozuedpApsqfl1+UtdHVQU2/e9lKqo1Y+bBPV1cjaa2YTIFXdY6mUeC/doamzUi/7Da8oIXabupyxC3If1mipFay2MjmpheXSbE1zqxRZ3VI/nuTDYVWNvVQNaaetnt/SklcSrq4XIcMVVQ69lB6p3Rrzqkf3G1Z5VYOowqo3VL+dQL3ZIfbeRioOs7nMRmkX4+yYYaK6d1/KNlrppXJNG293aTVuKsyofRo/+n6Pso1sAhjE1d7edm7kZkVvIMjqEhlbXipqnF4I4NT/2qsD86XyqOjtDnovAXSWvMwd1SrRqSsadIRLJZ86Q2J26rznRinLaOuHjfje9qzqRQiXVnjs0JU1oqxpNNbupSyWuiYkdSlNvX6pgxfoaEVv8SC7sMUYVOcvXYtq+17jhVVkLmF0wAblpb9bUUtLWKh+V95dutiRQ0QV1lUXYY0tzQsxL1b0Pf1IL2U8Vd1CMSqyvUu1GIR0gSknhGO9j6YftW9RDVTVKp2Lw9IpraoNq6ri2YTGmBeLJ3lid63Nen9/xoW+IMaFYqpnrDPZFQmz+VVu2yS4uadYmtSNLkgsbLd7J2XrJUx810vte8P33i21jb7Gqn+CNBVaqU2XqpK4mrQSHcl4NhX6j55tebytQK3ZMW7VE41WXNBh0auAriGKuV9iVkdTp3pK1SUFMXD02dWLK5p6C2I9TZYdbDQbh0mq8qp6iYvkHrcvM9rqs11508aINyir2hjxJz9n0Pntysh2jfhUOr9d2dyxER9J57crEzww4psYsz1vtiuLPC3i3en8Zo9oX2XMM3izPeJn6/zGiDfQ+e1l/HnGrMObvSNeX+d3jfghOr9rxDcx5rO8OTbie3T+wIjv1PkDI76JMS9/ODPi6zp/WsTv6vx2r1fZ6rPda132gvj8oLd7jc3GiM8M8Tri9z4n5MR2rwvaEvF9Xz0qn7Z7PdIxEJ8B9Havg9o14mNDvAfxqTix3Wu39ov4vs9++bTda8bOgPgYoLd7rdqBEe8d4vqID8aJ7V5fd1TEx+PTdq/rOz/ivYDe7vWEp0W8PcRnI94dJ7Z7DeQ5Ee+RT3tB/Dxt2Avi54HeEeIngd7FM3tP/exLxs/gxJaIt4ldO5XxA/l0DMRrasMxEK8J+jCIVwO9a8QPcW27RvwQTuwX8aNi134RP4pPZ0B8mzacAfFtoE+C+AbQB0Z8p2s7MOI7OXFUxPfHrqMivp9P50f8+Bd77/DzBvSXQPwG9GkRv+vaTov4XU6cE/GvYte7lSF7vEm2yudrVYb8LR5feY39+T631bSdgQeHqeJ7/OntbqE/DPFr0KdCv12js+MhPuLn09niJyEegxNnqP55wOntzhHfRup27Qq3+tzfJvGon/Mj/r1zrn2CfuR9p30ivo3g7dpgbvXZrgnmV0G8PTO2a7251edIdYt7fbppJwJ+4gn9ThC/S9t2jWy3+hyp4nqXdrxr6a6s1Yc53X9e/fFeeLBxxfUBK0PWIvk4FV6PoPQ4VXy3Unr8Wph1ERzq+eq9uOXnIf41MzbmxzbvEfgab8d4jfiZX3w64l9Qenxf/Xn0X0arfwfocbT6IVT/zqJPQryjXHLLNxl9Ac+1JdAtEX8S9KH21ZugOWaF1zN23btDvMo150L8u/Nv/D6QA57srcb69/96IsTvITsv4g3g7hHxr5mxAj8Ohvim8QMiXlHDD1K3+JBbPLtGfAf6U7wPZOVovV/Ej4rW+0W8Ispj2vFnYH2KMSdBfMPNnVMh/hTokyD+LNyzIf6QGVufCDwZ7tdAvF6dxBE/M/q/gPzn//75zz/+50fJU6vJ1Zx9Ss7V+I8/fqQ0WQ0plFq9uZIyYzlNIeWQvYul+FgrY8VPKVWXWyqh+FyDvmtTc0wWUooWQ2kaK1NLzSx5TcsgY9VNxmUxtpIZzn3dMCUXq7NYQi7W58t1MseqOYZqpVTNV+IUa0tcE0qJPoexRojWgsupNueT6To3lcxXvKsl5hr7WJtybA16XKvZe9GSwWEAYLYGTZYHNudLZSzCmeg63jzlAj9Syq5CeqfZTSGYiw7uuBJLHOs611ItlkDSktca8CVZdFaSj8lqXxccDdZHX2tqxem6EqbSLJpLlqNrzgYPvLWiZXOA6DBodiEkqDM47XwcvHeQnGFC8UhVNHdSYvXwqZUA5pjGaLJUnPMtSCyItI96SSnn6rNroC5jMMIbeFpjhUHG9/n6/KPPD67gIzyIIcbaxREm2JmECpa0HGyMlSzhGnBTamPJCuthXvO1ZZdmOhzKYxDtLMTkSm5jFNpQkACRKGrw9hMlhpBTQhApFctdjAzWmGOpDv5F84MlMBIcsfmcrOWu8wwW7CA41KeiajN1iDRVH9BKrxVD/Bk8DISpLRrXxKHGnblWmrQdQ4EFoY+GBptdwwLQaMgcg3DZV5iboi+tzd/HmKR16EW0gjQ+4La+EQDvC6JMNVwY5n1GVUEInbXksSQAgcqXTbbXBpswr5ARAsxCCL7Mi2ES0FBaCJJO+Bv64mGKtTqMaXC3mfQWkYogN09lGEm2ilQNs00z+MJX0WBG0YI4KMkpihm+GrRZ+XlNkYn8Yiy4mY7IM4+vOKWAcsPwmSPZedkR10k8ZTYG/sDc8M6lXF0ddHiHTqaGqjVZyVu9wjnEhteSZ4AT3fN51Kp5FKghzoyIBxy8Q4TVrsAUbHC2HodfZdZQXMspzwtKi7ENVBOLeLNexLJlpkyPfGO3dl/leeAwYgB5COO6jJ4YkvcudDH6NiV0CNeB88HNiYKQJtk4rtyjjnnRUHE9AMF7lB5XINczoRcFf2Imy8sdaJbbR+kCGlRyd1shTBGGYcHRR8tN19WpwVKMFuxN0+q6yoSF+U1eHZcrolEP9L/h7aAo1IEN05flcmkd2NBHw0OjdRH7Sl2HrCLnIL+GmmZ8gKbju5AccKoZOE1qb3kq0h45NkyvdP7BA6htAacEOWVeF+1GrKD1dXiBIGFXlsQY8e8DBiQTbDBjNDeFkMe6Uev5olg1nIWPE56syuXDiCo/KeYHXB68coqALs2yFMUEK5wy7lrzEQnwixIttlR7lAtxCo7oSrTCoHzXA/MT8Q7LZTTM2ERflX+GNQ4lmcdiynI+slrfozDYfMxJJDc5yTauI3ZzoQX8pXU+c12UYcKrKsydV+AgxMlx4cAsD55iWD2yFjc4GhpagA4pomBj3TjbpACKVjn0BYssA21CqKyAv0qta4Eo8Yitx1Z8UO3fbXJbSNhYMgzqDIljdQQVvHlsQ0crbtsIjIR615knAeERCiGUzYqXB73KqO7hiaP4Euhlqb45wY6ijEp6ay50IHmSh0ositusBBitkid2SUgYl8ROqYVuCVhZbOwP2NXglfywmGQBo2ePFGYmXBNRqjCBKBHwiDac0zUJQTR7M3kgIENxKcMEiW84maprUbey6C7xI0A1NHWim6I8+4SYMXxA5j6GFAvGhh0p2C9c9Y2r8BRQ3l0OzId7XmZYZOZDnVPfrGkfg4cbgssKpnhHvJAfGzQv00LrkTKQ2zAFvD2xlhViU8DOQ9XYHmCAuFvROfyVlIr9E7s+Zk2LXeIaCqZf2AbxYwgumEKqKRq4ZQeUUD9tXcRw1GRM2aK8BkbIXkk0ak/8b6dNsQdl7G5PGxXY+S8oZfP8Pfw9/D38Pfw9/D38Pfwy/JK8fP9Y+0fflVzZlLSrErk+mq+L78MpvM6c2FfrGOuWKa6uxy4730fGCkgiOZqROrOBvGW5+0hjO0wS7tjY6mhLoK2tiTrpaFUpZng73PrxDXnuMlzI4kjOSOPIscL1uT+2eHbOla0yyb+DffdNUvi2V1JDkkAKPobTVHTE7Fpz1siCBCeOSXSCQi4WdQbml0kQXyHTYP/uyP5nSuKk81gjsTASKx8FPvyWX4skN5clg/JYJYcNO0jLsDknhiizRatnAsm/mJBErlSflPFeoQQy6weUwA4SVwskSYVk7sJBU1ocZYpccbnadASItpWiI4dXQtPJjI6Cvc5uFn6TDJcYS0UxSGbTQiBAahVnS78FcJ+IU4wkxTXqUIMM7TJMbqbjc9hI5ptfFAI2BR2GOh1rXfhtaEnSiRl53mWKQrZYfUUOmMJ1J/KKf+DWMVnReXV64R+oSSm5Hl/2ky1YP17QP8twU8rsc0YR0duLYrrgyCENO0ChC6PpMgf2buhl8OED+grZKGovZcZmZ5A6uI9yGdWaTvQvWhyqLyVEHes7VnixkIhxNEiDL2mxhBwy2XWOKYQGpasGfpSuH5Po5MjCK5BcWGXd6NCL9iWdGcO8wvUv7khptiEXnQD8pGbeoZA6S073kBd00q3bRLElHZ0i3tgVHh4zt0cvcf7FD/bZBNvkzuATHK9QosP4iK66yhieFBK7ovVh3bOC7DRuG9UhGpuY1qeAMkB7lY3p/pLk6wGnM0qdkGiS2mWjs4dQo3yd685rXF378bmF3M8cGfaCU7zh/nTeEwrWNCYx3ZXDMwYmwLQ7v+PQbc2B70Fja0wLT3S/A42Qs5J9L+BxuC4jCt2B6SoVbGias6CDo2bRdz8fZ/dvaDWrsepi1garLOGhdQPJ0ESGS7dfrkYjuiHAZOZmOOv8FKARqVnw3R11xsJV3YPBokBQ2kXnM9LNYnVBj+DrmDrkKlNAB0Fgi0szj/vTERDmLbnrpE+G2iq+Dlk4HV4vbHU62SXcYGElieoxtYJSTVn3LTOOcbk66ECx5H56WboT6MMwWee8ptN8LwMOnWrYRtwnivmKCrVxtZ98azp61w09nTMtk+gwNOjsqcWY83Kx9VsYpTJ/zKksw9i57mLhk1rpAY7Rgsprw1Ck7og/Do3KU9dGXF+L+i1T64ZfYbjp1JQFkUDS8CAPhws8ZoA3uS1yLPhDWAKrPJK5WHvEOelcmKCCRs1gDK8dq5OTSll3Ni9CwClkgrhuFyOgRby6H9X9gLQ7X1wanEPAci9FN5gXtdQxIvxDZ4PO5C8s0ZFoSzqubF02usemW8CagvgRFK7nCCwLNmJy1k2vMIyvSAg5yo2GInfu5EtC0yQYAtalX8hCXnjitVUJkYjbsr8IBz33Opyu4mGaRZmn5OUtCc66TdftpvNER8MYSMK9iDXj6jixbzHdimk6OpdOSWi4GLyWbjshTBdFiXW7yTnJSi1V3ewW3WMvwF4dRZXc8YyXJVPQ7qVEBfcR+fLwgRlP3u8AFSxluBhQRt2vLLrzKvVeXKPuljo5F8zVdXsPY6uLHHQHnq9ZuSyJDpoLgV0Z3lhzi7FYDqJyOvrFM5rUJ3Y/ZboZq12CtoZu9g55wot0q1SsiNJvURJ0T4RJcdzN6e7noKTgB3SXTbejmKrNrjFqEpgiX6RQOZQqYPBseaAl6JZMzKLvr//844//+/O/lWldf/3+rl9z8Tufl8dfXkM8LdwXxNu/ueLZiD/5OYPOfxbxeXT+hlezHxvobYg/+TmGzq+D+Eg6vwLig+n8Bq/I+AIvjNiXzj/pBU7bA30e4psY8wzebI/42Tq/MeINdH57GX+eMevwZu+I19f5XSN+iM7vGvFNjPksb46N+B6dPzDiO3X+wIhvYszLH86M+LrOnxbxuzr/qVaip/ocpkHuwxCfH/S7zcy3J+2xiM8M8Tri9z4n5IQQnxDWB4jv++pR+XTyNpO/jfgMoL9Wa+9PIz42xHsQn4oTHyM+JKzfQnzfZ7982m/LoyMgPgbor9VKdCXEe4e4PuKDcWKPDfn2jfh4fNqyOczZEe8F9GGatR0H8fYQn414d5x4LOLdCfjhiPfIp70gfp427AXx80DvCPGTQO/imb2nfvYl42dwYo8tjx772amMH8inYyBeUxuOgXhN0IdBvBroXSN+iGvbNeKHcGK/iB8Vu/aL+FF8OgPi27ThDIhvA30SxDeAPjDiO13bgRHfyYmjIr4/dh0V8f18Oj/in7Xh/Ih/Bv0lEL8BfVrE77q20yJ+lxPnRPyr2PVuZcgeb5Kt8vlVLcw5QT+7+md7Lj4c8fYQn414d9B/VcW3Fxqfh/h3Pvvl1jEqNR92F8Y/bp39fLavP372itsjfjZfz4/4oxOB8yH+Gd27udNpoR/sXREPflvVDhGvwJvTIn4X0Z3VuAdmxjr1x0diwAqIjwT3s4gPhunXEFZ4j8DB+LHmmxOOAf0GxMc233sQf4jyGDzY4xtQ9lQZsk8pPuXppn1CfyTiPYDezbM+e79n9dQ3J+yCDed5c8JGz+wd4A7Okd75suOqgf0K+FGIP2TGqd8Vsbut+GnfI7CP57l24cn39T6Q09Uf/w6go1Xx7ej85Ejv9dnxDuSB9P7+uhs8ibrxjuxg7+d68N3UHSJeYeZ9PV/9jF339ohvxXfwNydskGfsGvFD2LC9Vv8dytnt+O8QvwDiD1Ge8Q0oq8t1HycCm0A/EeLd3Hd6GuI7v7I7xO7RYWrXiB8y8x4RPxb9rhE/xKZ3jfgh6A+AeOU96AEQ/z7KI7854bDnXJsg9odE/CHoE/nqT3Li6yH++FcHRnyneh8Y8VV8X0Crb96fHB7xhyh3cG9xK+hnRPwhM46QH68C9M1fT474Cvq/gPzn//75zz/+50eJU8g5WishNCup/uOPH6lNObscsi+hBl80lttktaWUog+plhwZK25KKTgrNcYWS9N1VidnLSaLLjFnnK8rqdRUYyk+5WxjrLqWPUtms1yz1nWTKy64XF1phV9ozCZXvbWQSki55aLvipacfOJq76Bb19UplmhgyBbC+G6xKfpaQ4n8k0sNGqtTslR8LK66YKFjS9AcHddmVkhZYyVMqbhYa+TrlpzWqH4CGReUGEKwKlpSnlIEiavF51bDvK5VYAG5mX4zaPYWvIMn5mvznc9havzRRS4JBUSDz8lBc67NqpXSv1ugxXsIbixlXjxNfvKa3iWILKyl6/wUGzJzKWUujZoPlvIFFqihIV+Dyj7qfYZTfBmSLCU/BlvJvnlz3qrPnTd8P7vEUrXW4pB7mUclyOCzz/AWOUuzJjf/0FTmLTfXvC+wRWJbfoPULUePEqF4LYQxmJoLqTX0hn9cslfXR0MbfDX4G1qwtPwKtBaShwcBHEM1/BRgCcDgXYQRM1hDQLAvJfQo5jbmDRVGt8bSCAFNerUkBMQA2/gXFa45vP1dZh7mQwuQUFz4gXYnOB2q9/xqLDw417JjgWIzNbHkaoCKKVUf/DytJI6JhWpZJlVfM/SyeGJ6yM5AQ84DSIDEknxBv0ID+FiEXxtMFuxW86IJwYBv2HpOwexnmXnsFjo9Bgeaha4UcoBX5gzNL4u8AldXL9Ei/ll/GEVYljpbuSC9olz6iwbyhYqOvV17uQjFSw2lgGuiY2ZXiFX8yM23Boev8iXWVIqJUMMDtFlHcRDJh1owQi/vNtiFvldfrCs+/J4FheHLR/ADts1wfC4gwigYii2VN6uaTUDHUJwUzZqEkaeMgCyiyQ37kE79sDzB74gdeGdhWG8WqoQJFjOHk5WlFiwDwqSmjgtd90JQ2wrzZRwnnlGyDWXC8D0eVy7RaTofJwwNbxZbqyl0FYggZSZJSA7L9yW4jplzDNg+1IjBHoeYCj4xFfm1Ll+cVcWOKmKXX9dQNoYAFNAGD7bZYeBPikPYRRzocHGmAT5mOTYUrWkNw2HjDjxezeRGwnDYLSAZw/aIKgNHmKKDC9huTHHA5bsVx4lpyP2hOcJWpgI7AYUZDRYEw2/m2ByRwVDaNiTkiTgogMvZJ6nODytTkz8TUxrGIPIiSyScGdQ2LRQHWyJeMLcCOXWwJdcJeaGGWV52QCMmYHgZiRWUJ5WhYwgHN0RAEctaD1DQjAfAIgmD8D+FsUiJ4EVdUHJADmLk0H12ip5Y2OAL9gOJUnA8Spcb8yEjqbHLxKLOK4ICYdsIZoo0nUBP/FRwwsHJNXYNqhNxruGrHIN+5nKTRqHOOAHfHQahnIDltYLsIEiDYpqwGdiJGkFy3y5EhSzEAK0ho/dCZmkiqqPgOA2ct5iHbFEM75AEPO1+H1lUFsRYMHFFTzGUYOfxuqhQgS02O+tcAqTiM4lYxIE0q6QZnMQpESj7toKtC+aEhPCUbdZwwxIYYgvAfBhOGCE1Shkxd/Y0vhsbPECmBVR9N9Mdc5JFAxPDxdasj0UMmsnYNeHsMJA8QrlXNERmRIbcgyzL4z6jOOqw4B7yvcK2lLbK1zYfL97ET4ZMcvfPqSz7piilBHmVxY7tEH6usiOxIv4Mp6MwgzIkxdXaZieBc6iwoWkb48O8rdM+yqSF+B3xMCU8QkZdiCAonFzcj4zXgTOtKDLO1oqHyXJA6LXHgccRZLAQ9lFYMeGy5C7SHNnrdV4RbKL1oJyJyuwOsUHtFca+JPW4pX1dVLzpRLOIeeIEEsZ8Qt8PecfCMDWy81BYlwB8nggEyLxi1Oz/8mzr8Jigk2uRXx7fxbzEe4JKzvUS4eUDWENhChPve1kEjTUEdk7aiCCzOQIgY/azkBkUSIM2zv922jn7CRGyJSXAYvfo779Yjx329/D38Pfw9/D38Pfw9/DL8E9J2/ePDX703curzQv7O7I+/otDRmUyNpzsiNhWNaU///qh3OUnibYrcjb2d1fFn69qBTnk1UksL8OW2BxmUmQf2CyHq3NfIyS5lD6+WMcQjZ0iOcwyzFqVrNDY4JLeFobZzrK1JoXLpCYtkW5XUe3fTh3JkdPPk4RG8mxjDi4mX9LxZ8shNRffkKdjU3bgZO1vhmEcKTSZ/zU+vYPc7DIHGT67b2aNOgqcmVqVbWWdWyrRqBavgCH3m+ljP+11xEU2yUzsgRmOnSOkTIVLExvomLUk+/Qw6fBBMjN+X1J+Mzd6ZoEMytZ0KInsj2wzKRtqpPm2LJlJ8pCtEnSSYcmmathFZWxeaMhcZzhpKsqzXcr6grOZ7kjm25AimUf2pCf176z6mEB4IsE7V1AGndiNSZLOAapXOk4Ggn4vBDLJOCXL/LKWZe4icRlJUSETKfPceVKST97LAplMSHOXWwmsk1XSZxIuMn8xZvAkTMk8iRPTOhIgV8bcgSRcmTvJnlK0PlxFidI4Ml6dYOh4BJ/RWSU1Jd8unkTS+3Ixhpsk7yKZKBzU0Qx+irmDVJNUsiijMx2TNOhWQjpPYlk+Iy/GgBRKahJmxdwBtUxNakeGLo1gIllUuEcznc4s0auqA+PZGNKUdRgSSaF1F2Cmmuy7eKdzphaDzk4Gt+uELXnsxmUdsVoZWqIzFWXvlfQVFx1tXH0rfV73U8iwdVBv8oyhM0q3CBCVjkdLDXLz9Zcg/XL6SzZ88UhNaTqZsTmdiWs4324ipO/M7qBDhw1hEFh0D8RDL5EpD08aF+XxHieKquFll6l1OBB1ouLh5OL+iWW4BxQkipEh3CNfHUfizjEBPBustKHyaYqFaTEZvClyz3+bO0vjLuQRZYoOdqyGPto0BYTiXY14IerbIhkFPAUhY70kFz1mTvgQHDnIg05rL1NjXFGnvERUZuPqLOeFe9FpUCAq5+7q4lAG6EoNy0D4Q1m97BeCMzQYYaqMrcDsSYSmFLS2hXiJfAQIHSNmcdaXiyvmUt0r5L9UFfNDdw0F/VBY4X82dNhL46NFHdEUIgbTzBofJpk4U2OPjVXL4op1BAkxxUUdR87KGidZV2NiHf61vEyND9L9umZsIGpZiNZJm5eXt+4IBtUN6cKpBv90wpfTZQ7fqXM4Vg8pyyRIIBL4dPoFpTAkdGfpk6wDGwtIwbfFloSbYVPgc6kublvnYpABMxxbgbRg1N3OKl2HcjY9Y24mCTpBNhwBBhsvYtfXddDoGwqfh2fQLYCq24M5m5P3voRD/B77nSAHD6eGew5TP8hGS4hzSFhSt84SnSXqOLk6negtOiJ1RDFzqvxPgWLQJxeq0398FJqThrbWSUqtGyBwAL+9ODTxLgAHm9ap5Bi2KehuL4FFvG3JLy4UYddI5IAYnbVeZNN0gxLN033P0Bb6fGRHUxzRBvHG4YqITF7bH499eDSrLDY29iSYFzG/+YupR7aEIJRGulmMbdLRJkTowFp+eiEj6VYkniUhc1v0TOfCaKrLCvdYYBlY0Jyiu6SoZcZjpLKsmJOMxnSI3ZzN1qFbPpgWXtu0GbO0yDGabqI3hMXmYMEYplCkvQo0uExRErpCZadTdagLclUvID3i0v0qVNvJ1q12y3Mh6e9sQ6VVy95IG6woWpy8/2VP11Ubpy2gcdmhSrWjZSyjwfYS4yJ20301zLHptrSctu795Un361BAPGKVzx1Lon+YB97G69Z2K5dJEDnxVAujVctWD/DSvqp7ay7GvjfqckeVcGk612Z/nYdXRAqIHP7Vpnvz4TIMf3CtRXdSMp5gkQLOidnRBBQthLyE38CmSw8PsIlETeKyq1HakFyQyWvvNKwpTSi1bh1WxKu7qDjiLhxIw0YRXNQNWplNGQ5GDzQQ9sgWqnyrki/sGm0lF0OPMRvlCSl1k3RscsddId0GH247Tey6DN7qBqrujI8l4ZTXzl839Iw0Jgw1MRw0CkmQa7qF1WUW//rPX//1/wDm92Y='
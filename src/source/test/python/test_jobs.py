@@ -0,0 +1,71 @@
+from nupack import Model, RawComplex, thermo, core
+import numpy as np, pytest
+
+################################################################################
+
+def logq(strands, model):
+    '''log partition function computed in the foreground'''
+    models = [thermo.CachedModel(model=model, kind='pf', bits=64)]
+    return thermo.dynamic_program(env=core.Local(1), strands=RawComplex(strands),
+        models=models, cache=0, observe=None, pairing=thermo.obs())
+
+def random_strands(n, length, seed=0):
+    rng = np.random.RandomState(seed)
+    return [''.join(rng.choice(list('ACGT'), length)) for _ in range(n)]
+
+################################################################################
+
+def test_job_result():
+    model = Model()
+    strands = ['AGTCTAGGATTCGGCGTGGGTTAA', 'TTAACCCACGCCGAATCCTAGACT', 'GGGAAACCC']
+    exe = thermo.JobExecutor(2)
+    assert exe.n_workers() == 2
+    job = exe.submit(strands, model, cache=10**8)
+    assert np.isclose(job.get(), logq(strands, model), rtol=1e-10)
+    assert job.ready() and job.progress() == 1 and job.stopped() == 'none'
+
+################################################################################
+
+def test_job_progress_and_cancel():
+    # a paused job blocks at its first check, so it is still pending when it is cancelled
+    job = thermo.JobExecutor(1).submit(random_strands(3, 300), Model(), paused=True)
+    assert not job.wait(0.1)
+    assert not job.ready() and job.progress() == 0
+
+    job.cancel()
+    assert job.wait(60)
+    assert job.stopped() == 'cancelled'
+    assert job.progress() < 1
+    with pytest.raises(thermo.JobInterrupted) as err:
+        job.get()
+    assert err.value.reason == 'cancelled'
+
+################################################################################
+
+def test_job_resume_progress():
+    job = thermo.JobExecutor(1).submit(random_strands(2, 60), Model(), paused=True)
+    assert not job.wait(0.1) and job.progress() == 0
+    job.resume()
+    # progress only counts finished blocks, so it never decreases and ends at 1
+    seen = [job.progress()]
+    while not job.wait(0.01):
+        seen.append(job.progress())
+    seen.append(job.progress())
+    assert sorted(seen) == seen and seen[-1] == 1
+    assert job.stopped() == 'none' and np.isfinite(job.get())
+
+################################################################################
+
+def test_job_limits():
+    exe = thermo.JobExecutor(1)
+    # the deadline passes while the job is paused, so it times out before doing any work
+    job = exe.submit(random_strands(3, 300, seed=1), Model(), seconds=0.05, paused=True)
+    assert job.wait(60) and job.stopped() == 'timeout'
+    with pytest.raises(thermo.JobInterrupted) as err:
+        job.get()
+    assert err.value.reason == 'timeout'
+
+    job = exe.submit(random_strands(2, 200, seed=2), Model(), bytes=1000)
+    assert job.wait(60) and job.stopped() == 'memory'
+
+################################################################################
@@ -1,10 +1,30 @@
 import nupack as nu
+import pytest
 
 def test_loop_energy():
     em = nu.Model(ensemble='some-nupack3', material='rna95-nupack3')
     assert abs(em.beta - 1.6225317071110157) < 1e-8
     assert em.hairpin_energy('AAAAT') == 4.1
 
+def test_model_members_read_only():
+    # the fingerprint is computed on construction, so members which it covers cannot be modified
+    model = nu.Model()
+    fingerprint = model.fingerprint()
+    for key, value in [('beta', 1.0), ('ensemble', nu.Ensemble.nostacking), ('conditions', nu.Conditions(celsius=50))]:
+        with pytest.raises(Exception):
+            setattr(model, key, value)
+    assert model.fingerprint() == fingerprint
+    assert model.fingerprint() != nu.Model(celsius=50).fingerprint()
+
+def test_model_copies_keep_fingerprint():
+    import pickle
+    model = nu.Model(ensemble='nostacking')
+    assert pickle.loads(pickle.dumps(model)).fingerprint() == model.fingerprint()
+    stacking = model.with_ensemble('stacking')
+    assert stacking.ensemble == nu.Ensemble.stacking
+    assert stacking.fingerprint() == nu.Model(ensemble='stacking').fingerprint()
+    assert model.with_ensemble('nostacking').fingerprint() == model.fingerprint()
+
 def test_stack_energy():
     mod = nu.Model()
     pairs = 'AT CG GC TA GT TG'.split()
@@ -22,3 +42,45 @@ def test_structure_energy():
     assert model.structure_energy('CCCCTTTGGGG', '((((...))))') == -4.6
     assert model.structure_energy('GGAAACC', '.(...).') == 3.3
     assert abs(nu.Model(ensemble='stacking', material='rna95-nupack3').structure_energy('GGAAACC', '.(...).') - 2.7239996321033035) < 1e-8
+
+def test_structure_energies():
+    model = nu.Model(ensemble='some-nupack3', material='rna95-nupack3')
+    items = [('CCCCTTTGGGG', '((((...))))'), ('GGAAACC', '.(...).'), ('CCCCTTTGGGG', '...........')] * 5
+    energies = nu.structure_energies(items, model, threads=2)
+    assert list(energies) == [model.structure_energy(s, p) for s, p in items]
+
+def test_first_passage_times():
+    model = nu.Model()
+    run = lambda threads: nu.first_passage_times('GGGGAAAACCCC', '............', [('((((....))))', 0)], model,
+                                                 trajectories=4, max_time=1.0, seed=7, threads=threads)
+    out = run(2)
+    assert len(out) == 4
+    # each trajectory has its own generator, so the results do not depend on the threads
+    assert [(t, s, str(p)) for t, s, _, p, _ in run(1)] == [(t, s, str(p)) for t, s, _, p, _ in out]
+    for time, steps, reached, pairs, energy in out:
+        assert reached == 0 and 0 < time < 1.0 and steps > 0
+        assert abs(energy - model.structure_energy('GGGGAAAACCCC', '((((....))))')) < 1e-4
+
+    # loops are split and merged in place, so check the running energy after many steps
+    strand = 'GGGAGCAAAGCUCCCAUAUGGGAAACCCAUA'
+    for time, steps, reached, pairs, energy in nu.first_passage_times(strand, '.' * len(strand), [],
+            model, trajectories=2, max_time=1.0, max_steps=2000, seed=11):
+        assert reached == -1 and steps == 2000
+        assert abs(energy - model.structure_energy(strand, pairs, distinguishable=True)) < 1e-3
+
+def test_pairing_action():
+    from nupack import thermo, core
+    import numpy as np
+    model = nu.Model()
+    strand = 'GGGGAAAACCCCAUAUGGGAAACCC'
+    n = len(strand)
+    logq = lambda pairing: thermo.dynamic_program(env=core.Local(1), strands=nu.RawComplex([strand]),
+        models=[thermo.CachedModel(model=model, kind='pf', bits=64)], cache=0, observe=None, pairing=pairing)
+    free = logq(thermo.obs())
+    assert abs(logq(thermo.PairingAction(np.ones((n, n), dtype=bool))) - free) < 1e-10
+    # with no pair permitted only the unpaired structure is left
+    assert abs(logq(thermo.PairingAction(np.zeros((n, n), dtype=bool)))) < 1e-10
+    # forbidding some pairs can only lower the partition function
+    allowed = np.ones((n, n), dtype=bool)
+    allowed[:4, :] = allowed[:, :4] = False
+    assert logq(thermo.PairingAction(allowed)) < free